@@ -13,6 +13,8 @@
 #include "MantidKernel/ThreadPool.h"
 #include "MantidNexus/NexusFile.h"
 
+#include <atomic>
+#include <mutex>
 #include <numeric>
 #include <optional>
 #include <vector>
@@ -69,24 +71,20 @@ public:
 
   //-----------------------------------------------------------------------------------
   /** @return the next available box Id.
-   * Call when creating a MDBox to give it an ID. */
-  size_t getNextId() { return m_maxId++; }
+   * Call when creating a MDBox to give it an ID. Thread-safe. */
+  size_t getNextId() { return m_maxId.fetch_add(1, std::memory_order_relaxed); }
 
   //-----------------------------------------------------------------------------------
   /** @return the maximum (not-inclusive) ID number anywhere in the workspace.
    */
-  size_t getMaxId() const { return m_maxId; }
+  size_t getMaxId() const { return m_maxId.load(std::memory_order_relaxed); }
 
   //-----------------------------------------------------------------------------------
   /** Set the new maximum ID number anywhere in the workspace.
    * Should only be called when loading a file.
    * @param newMaxId value to set the newMaxId to
    */
-  void setMaxId(size_t newMaxId) { m_maxId = newMaxId; }
-
-  //-----------------------------------------------------------------------------------
-  /** @return the mutex for avoiding simultaneous assignments of box Ids. */
-  inline std::mutex &getIdMutex() { return m_idMutex; }
+  void setMaxId(size_t newMaxId) { m_maxId.store(newMaxId, std::memory_order_relaxed); }
 
   //-----------------------------------------------------------------------------------
   /** Return true if the MDBox should split, given :
@@ -443,8 +441,9 @@ private:
   size_t nd;
 
   /** The maximum ID number of any boxes in the workspace (not inclusive,
-   * i.e. maxId = 100 means there the highest ID number is 99.  */
-  size_t m_maxId;
+   * i.e. maxId = 100 means there the highest ID number is 99.
+   * Atomic so that boxes split in parallel can claim IDs without locking. */
+  std::atomic<size_t> m_maxId;
 
   /// Splitting threshold
   size_t m_SplitThreshold;
@@ -501,9 +500,6 @@ private:
   /// level (e.g. (splitInto ^ ndims) ^ depth )
   std::vector<double> m_maxNumMDBoxes;
 
-  /// Mutex for getting IDs
-  std::mutex m_idMutex;
-
   // the class which does actual IO operations, including MRU support list
   std::shared_ptr<IBoxControllerIO> m_fileIO;
 
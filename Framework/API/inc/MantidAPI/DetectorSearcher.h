@@ -8,8 +8,9 @@
 
 #include "MantidAPI/DllConfig.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorBoundingVolumeHierarchy.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
-#include "MantidGeometry/Objects/InstrumentRayTracer.h"
 #include "MantidKernel/NearestNeighbours.h"
 #include "MantidKernel/V3D.h"
 
@@ -22,8 +23,8 @@
   This class solves the problem of finding a detector given a Qlab vector. Two
   search strategies are used depending on the instrument's geometry.
 
-  1) For rectangular detector geometries the InstrumentRayTracer class is used
-  to recursively search the instrument tree.
+  1) For rectangular detector geometries a DetectorBoundingVolumeHierarchy
+  over the detectors and banks is used to find the detector hit first.
 
   2) For geometries which do not use rectangular detectors ray tracing to every
   component is very expensive. In this case it is quicker to use a
@@ -43,7 +44,8 @@ public:
   using DetectorSearchResult = std::tuple<bool, size_t>;
 
   /// Create a new DetectorSearcher with the given instrument & detectors
-  DetectorSearcher(const Geometry::Instrument_const_sptr &instrument, const Geometry::DetectorInfo &detInfo);
+  DetectorSearcher(const Geometry::Instrument_const_sptr &instrument, const Geometry::DetectorInfo &detInfo,
+                   const Geometry::ComponentInfo &compInfo);
   /// Find a detector that intsects with the given Qlab vector
   DetectorSearchResult findDetectorIndex(const Kernel::V3D &q);
 
@@ -67,7 +69,7 @@ private:
 
   // Instance variables
 
-  /// flag for whether to use InstrumentRayTracer or NearestNeighbours
+  /// flag for whether to use ray tracing or NearestNeighbours
   const bool m_usingFullRayTrace;
   /// flag for whether the crystallography convention is to be used
   const double m_crystallography_convention;
@@ -79,8 +81,8 @@ private:
   std::vector<size_t> m_indexMap;
   /// Detector search cache for fast look-up of detectors
   std::unique_ptr<Kernel::NearestNeighbours<3>> m_detectorCacheSearch;
-  /// instrument ray tracer object for searching in rectangular detectors
-  std::unique_ptr<Geometry::InstrumentRayTracer> m_rayTracer;
+  /// tree of detector boxes for ray tracing in rectangular detectors
+  std::unique_ptr<Geometry::DetectorBoundingVolumeHierarchy> m_detectorHierarchy;
 };
 } // namespace API
 } // namespace Mantid
@@ -39,7 +39,7 @@ BoxController *BoxController::clone() const {
 
 /*Private Copy constructor used in cloning */
 BoxController::BoxController(const BoxController &other)
-    : nd(other.nd), m_maxId(other.m_maxId), m_SplitThreshold(other.m_SplitThreshold),
+    : nd(other.nd), m_maxId(other.getMaxId()), m_SplitThreshold(other.m_SplitThreshold),
       m_significantEventsNumber(other.m_significantEventsNumber), m_maxDepth(other.m_maxDepth),
       m_numEventsAtMax(other.m_numEventsAtMax), m_splitInto(other.m_splitInto), m_splitTopInto(other.m_splitTopInto),
       m_numSplit(other.m_numSplit), m_numTopSplit(other.m_numTopSplit),
@@ -49,7 +49,7 @@ BoxController::BoxController(const BoxController &other)
       m_fileIO(std::shared_ptr<API::IBoxControllerIO>()) {}
 
 bool BoxController::operator==(const BoxController &other) const {
-  if (nd != other.nd || m_maxId != other.m_maxId || m_SplitThreshold != other.m_SplitThreshold ||
+  if (nd != other.nd || getMaxId() != other.getMaxId() || m_SplitThreshold != other.m_SplitThreshold ||
       m_maxDepth != other.m_maxDepth || m_numSplit != other.m_numSplit ||
       m_splitInto.size() != other.m_splitInto.size() || m_numMDBoxes.size() != other.m_numMDBoxes.size() ||
       m_numMDGridBoxes.size() != other.m_numMDGridBoxes.size() ||
@@ -112,12 +112,7 @@ BoxController::~BoxController() {
  * @param range  --range number of box-id-s to lock
  * @returns initial ID to use in the range
  */
-size_t BoxController::claimIDRange(size_t range) {
-  std::lock_guard<std::mutex> lock(m_idMutex);
-  size_t tmp = m_maxId;
-  m_maxId += range;
-  return tmp;
-}
+size_t BoxController::claimIDRange(size_t range) { return m_maxId.fetch_add(range, std::memory_order_relaxed); }
 /** Serialize to an XML string
  * @return XML string
  */
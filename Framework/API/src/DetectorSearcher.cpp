@@ -6,13 +6,13 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAPI/DetectorSearcher.h"
 #include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Objects/Track.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/NearestNeighbours.h"
 
 #include <tuple>
 
-using Mantid::Geometry::InstrumentRayTracer;
 using Mantid::Kernel::V3D;
 using namespace Mantid;
 using namespace Mantid::API;
@@ -33,16 +33,17 @@ double getQSign() {
  *
  * @param instrument :: the instrument to find detectors in
  * @param detInfo :: the Geometry::DetectorInfo object for this instrument
+ * @param compInfo :: the Geometry::ComponentInfo object for this instrument
  */
 DetectorSearcher::DetectorSearcher(const Geometry::Instrument_const_sptr &instrument,
-                                   const Geometry::DetectorInfo &detInfo)
+                                   const Geometry::DetectorInfo &detInfo, const Geometry::ComponentInfo &compInfo)
     : m_usingFullRayTrace(instrument->containsRectDetectors() == Geometry::Instrument::ContainsState::Full),
       m_crystallography_convention(getQSign()), m_detInfo(detInfo), m_instrument(instrument) {
 
   /* Choose the search strategy to use
    * If the instrument uses rectangular detectors (e.g. TOPAZ) then it is faster
-   * to run a full ray trace starting from the top of the instrument. This is
-   * due to the speed up of looking up a single pixel in the rectangular
+   * to run a full ray trace through a tree of the detector and bank boxes. This
+   * is due to the speed up of looking up a single pixel in the rectangular
    * detector.
    *
    * If the instrument does not use rectangular detectors (e.g. WISH, CORELLI)
@@ -52,7 +53,7 @@ DetectorSearcher::DetectorSearcher(const Geometry::Instrument_const_sptr &instru
   if (!m_usingFullRayTrace) {
     createDetectorCache();
   } else {
-    m_rayTracer = std::make_unique<InstrumentRayTracer>(instrument);
+    m_detectorHierarchy = std::make_unique<Geometry::DetectorBoundingVolumeHierarchy>(compInfo, detInfo);
   }
 }
 
@@ -126,18 +127,12 @@ DetectorSearcher::DetectorSearchResult DetectorSearcher::findDetectorIndex(const
  */
 DetectorSearcher::DetectorSearchResult DetectorSearcher::searchUsingInstrumentRayTracing(const V3D &q) {
   const auto direction = convertQtoDirection(q);
-  m_rayTracer->traceFromSample(direction);
-  const auto det = m_rayTracer->getDetectorResult();
+  const auto detIndex = m_detectorHierarchy->findDetector(m_detInfo.samplePosition(), direction);
 
-  if (!det)
+  if (!detIndex || m_detInfo.isMasked(*detIndex))
     return std::make_tuple(false, 0);
 
-  const auto detIndex = m_detInfo.indexOf(det->getID());
-
-  if (m_detInfo.isMasked(detIndex) || m_detInfo.isMonitor(detIndex))
-    return std::make_tuple(false, 0);
-
-  return std::make_tuple(true, detIndex);
+  return std::make_tuple(true, *detIndex);
 }
 
 /** Find the index of a detector given a vector in Qlab space using a nearest
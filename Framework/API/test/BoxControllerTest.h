@@ -15,6 +15,7 @@
 #include <memory>
 #include <optional>
 #include <stdexcept>
+#include <thread>
 #include <vector>
 
 using namespace Mantid;
@@ -75,6 +76,31 @@ public:
     TS_ASSERT_EQUALS(sc.getMaxDepth(), 6);
   }
 
+  void test_IDs_claimed_in_parallel_are_unique() {
+    BoxController sc(3);
+    constexpr size_t numClaims = 1000;
+    std::vector<size_t> firstIds(numClaims);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; ++t)
+      threads.emplace_back([&sc, &firstIds, t]() {
+        for (size_t i = t; i < numClaims; i += 4)
+          firstIds[i] = (i % 2 == 0) ? sc.getNextId() : sc.claimIDRange(3);
+      });
+    for (auto &thread : threads)
+      thread.join();
+
+    // every range of IDs handed out is disjoint from the others
+    TS_ASSERT_EQUALS(sc.getMaxId(), numClaims / 2 * 4);
+    std::vector<bool> used(sc.getMaxId(), false);
+    for (size_t i = 0; i < numClaims; ++i) {
+      const size_t range = (i % 2 == 0) ? 1 : 3;
+      for (size_t id = firstIds[i]; id < firstIds[i] + range; ++id) {
+        TS_ASSERT(!used[id]);
+        used[id] = true;
+      }
+    }
+  }
+
   void test_maxNumBoxes() {
     BoxController sc(3);
     sc.setSplitInto(10);
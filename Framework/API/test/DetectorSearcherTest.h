@@ -31,8 +31,8 @@ public:
     ExperimentInfo expInfo2;
     expInfo2.setInstrument(inst2);
 
-    TS_ASSERT_THROWS_NOTHING(DetectorSearcher searcher(inst1, expInfo1.detectorInfo()))
-    TS_ASSERT_THROWS_NOTHING(DetectorSearcher searcher(inst2, expInfo2.detectorInfo()))
+    TS_ASSERT_THROWS_NOTHING(DetectorSearcher searcher(inst1, expInfo1.detectorInfo(), expInfo1.componentInfo()))
+    TS_ASSERT_THROWS_NOTHING(DetectorSearcher searcher(inst2, expInfo2.detectorInfo(), expInfo2.componentInfo()))
   }
 
   void test_search_cylindrical() {
@@ -41,7 +41,7 @@ public:
     ExperimentInfo expInfo;
     expInfo.setInstrument(inst);
 
-    DetectorSearcher searcher(inst, expInfo.detectorInfo());
+    DetectorSearcher searcher(inst, expInfo.detectorInfo(), expInfo.componentInfo());
     const auto checkResult = [&searcher](const V3D &q, size_t index) {
       const auto result = searcher.findDetectorIndex(q);
       TS_ASSERT(std::get<0>(result))
@@ -84,7 +84,7 @@ public:
     expInfo.setInstrument(inst);
     const auto &info = expInfo.detectorInfo();
 
-    DetectorSearcher searcher(inst, info);
+    DetectorSearcher searcher(inst, info, expInfo.componentInfo());
     const auto resultNull = searcher.findDetectorIndex(V3D(0, 0, 0));
     TS_ASSERT(!std::get<0>(resultNull))
 
@@ -98,7 +98,7 @@ public:
     expInfo.setInstrument(inst);
     const auto &info = expInfo.detectorInfo();
 
-    DetectorSearcher searcher(inst, info);
+    DetectorSearcher searcher(inst, info, expInfo.componentInfo());
     const auto resultNull = searcher.findDetectorIndex(V3D(0, 0, 0));
     TS_ASSERT(!std::get<0>(resultNull))
 
@@ -112,7 +112,7 @@ public:
     expInfo.setInstrument(inst);
     const auto &info = expInfo.detectorInfo();
 
-    DetectorSearcher searcher(inst, info);
+    DetectorSearcher searcher(inst, info, expInfo.componentInfo());
     const auto checkResult = [&searcher](V3D q, size_t index) {
       const auto result = searcher.findDetectorIndex(q);
       TS_ASSERT(std::get<0>(result))
@@ -143,7 +143,7 @@ public:
     expInfo.setInstrument(inst);
     const auto &info = expInfo.detectorInfo();
 
-    DetectorSearcher searcher(inst, info);
+    DetectorSearcher searcher(inst, info, expInfo.componentInfo());
 
     std::vector<double> xDirections(100);
     std::vector<double> yDirections(100);
@@ -185,7 +185,7 @@ public:
     expInfo.setInstrument(inst);
     const auto &info = expInfo.detectorInfo();
 
-    DetectorSearcher searcher(inst, info);
+    DetectorSearcher searcher(inst, info, expInfo.componentInfo());
 
     std::vector<double> xDirections(50);
     std::vector<double> yDirections(50);
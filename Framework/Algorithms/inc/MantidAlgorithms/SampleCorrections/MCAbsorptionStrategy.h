@@ -49,6 +49,10 @@ public:
                          MCInteractionStatistics &stats) override;
 
 private:
+  std::pair<std::shared_ptr<Geometry::Track>, std::shared_ptr<Geometry::Track>>
+  generateTracks(Kernel::PseudoRandomNumberGenerator &rng, const Geometry::BoundingBox &scatterBounds,
+                 const Kernel::V3D &finalPos, MCInteractionStatistics &stats) const;
+
   std::shared_ptr<IMCInteractionVolume> m_scatterVol;
   const IBeamProfile &m_beamProfile;
   const size_t m_nevents;
@@ -44,7 +44,9 @@ void ClearCache::init() {
                   "Clears the file cache of the downloaded instrument "
                   "definitions.  This can be repopulated using "
                   "DownloadInstrument.");
-  declareProperty("GeometryFileCache", false, "Clears the file cache of the triangulated detector geometries.");
+  declareProperty("GeometryFileCache", false,
+                  "Clears the file cache of the triangulated detector geometries and of the instruments built from "
+                  "instrument definitions.");
   declareProperty("WorkspaceCache", false, "Clears the memory cache of any workspaces.");
   declareProperty("UsageServiceCache", false, "Clears the memory cache of usage data.");
   declareProperty("FilesRemoved", 0, "The number of files removed. Memory clearance do not add to this.",
@@ -99,6 +101,10 @@ void ClearCache::exec() {
                 "cache (GeometryFileCache).");
     std::filesystem::path GeomPath = localPath / "geometryCache";
     int filecount = deleteFiles(GeomPath.string(), "*.vtp");
+    // instruments cached by InstrumentCache, with any left partly written
+    const std::filesystem::path instrumentsPath = GeomPath / "instruments";
+    filecount += deleteFiles(instrumentsPath.string(), "*.instrument");
+    filecount += deleteFiles(instrumentsPath.string(), "*.part");
     g_log.information() << filecount << " files deleted\n";
     filesRemoved += filecount;
   }
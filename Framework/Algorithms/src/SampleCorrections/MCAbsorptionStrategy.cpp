@@ -70,61 +70,51 @@ void MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng, c
                                      std::vector<double> &attenuationFactors, std::vector<double> &attFactorErrors,
                                      MCInteractionStatistics &stats) {
   const auto scatterBounds = m_scatterVol->getFullBoundingBox();
-  const auto nbins = static_cast<int>(lambdas.size());
+  const auto nbins = lambdas.size();
   Geometry::IObject_sptr gv = m_scatterVol->getGaugeVolume();
 
   std::vector<double> wgtMean(attenuationFactors.size()), wgtM2(attenuationFactors.size());
+  // increment standard deviation using Welford algorithm
+  const auto accumulate = [&](const size_t i, const size_t j, const double wgt) {
+    attenuationFactors[j] += wgt;
+    double delta = wgt - wgtMean[j];
+    wgtMean[j] += delta / static_cast<double>(i + 1);
+    wgtM2[j] += delta * (wgt - wgtMean[j]);
+    // calculate sample SD (M2/n-1)
+    // will give NaN for m_events=1, but that's correct
+    attFactorErrors[j] = sqrt(wgtM2[j] / static_cast<double>(i));
+  };
 
-  for (size_t i = 0; i < m_nevents; ++i) {
-    std::shared_ptr<Geometry::Track> beforeScatter;
-    std::shared_ptr<Geometry::Track> afterScatter;
-    for (int j = 0; j < nbins; ++j) {
-      size_t attempts(0);
-      do {
-        bool success = false;
-        if (m_regenerateTracksForEachLambda || j == 0) {
-          const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
-          std::tie(success, beforeScatter, afterScatter) =
-              m_scatterVol->calculateBeforeAfterTrack(rng, neutron.startPos, finalPos, stats);
-        } else {
-          success = true;
-        }
-        if (!success) {
-          ++attempts;
-        } else {
-          const double lambdaStep = lambdas[j];
-          double lambdaIn(lambdaStep), lambdaOut(lambdaStep);
-          if (m_EMode == DeltaEMode::Direct) {
-            lambdaIn = lambdaFixed;
-          } else if (m_EMode == DeltaEMode::Indirect) {
-            lambdaOut = lambdaFixed;
-          } else {
-            // elastic case already initialized
-          }
-          const double wgt =
-              beforeScatter->calculateAttenuation(lambdaIn) * afterScatter->calculateAttenuation(lambdaOut);
-          attenuationFactors[j] += wgt;
-          // increment standard deviation using Welford algorithm
-          double delta = wgt - wgtMean[j];
-          wgtMean[j] += delta / static_cast<double>(i + 1);
-          wgtM2[j] += delta * (wgt - wgtMean[j]);
-          // calculate sample SD (M2/n-1)
-          // will give NaN for m_events=1, but that's correct
-          attFactorErrors[j] = sqrt(wgtM2[j] / static_cast<double>(i));
+  // the wavelengths either side of the scatter point which follow the wavelength of the bin
+  const bool lambdaInVaries = m_EMode != DeltaEMode::Direct;
+  const bool lambdaOutVaries = m_EMode != DeltaEMode::Indirect;
+  std::vector<double> exponents(nbins);
 
-          break;
-        }
-        if (attempts == m_maxScatterAttempts) {
-          throw std::runtime_error("Unable to generate valid track through "
-                                   "sample interaction volume after " +
-                                   std::to_string(m_maxScatterAttempts) +
-                                   " attempts. Try increasing the maximum "
-                                   "threshold or if this does not help then "
-                                   "please check the defined shape and, "
-                                   "if defined, the gauge volume (both its shape "
-                                   "and its intersection with the defined sample shape).");
-        }
-      } while (true);
+  for (size_t i = 0; i < m_nevents; ++i) {
+    if (m_regenerateTracksForEachLambda) {
+      for (size_t j = 0; j < nbins; ++j) {
+        const auto [beforeScatter, afterScatter] = generateTracks(rng, scatterBounds, finalPos, stats);
+        const double lambdaIn = lambdaInVaries ? lambdas[j] : lambdaFixed;
+        const double lambdaOut = lambdaOutVaries ? lambdas[j] : lambdaFixed;
+        accumulate(i, j, beforeScatter->calculateAttenuation(lambdaIn) * afterScatter->calculateAttenuation(lambdaOut));
+      }
+    } else if (nbins > 0) {
+      // the same tracks serve every wavelength: sum the exponents of their links and take a single exponential
+      // for each wavelength
+      const auto [beforeScatter, afterScatter] = generateTracks(rng, scatterBounds, finalPos, stats);
+      std::fill(exponents.begin(), exponents.end(), 0.);
+      double fixedFactor(1.);
+      if (lambdaInVaries)
+        beforeScatter->addAttenuationExponents(lambdas, exponents);
+      else
+        fixedFactor = beforeScatter->calculateAttenuation(lambdaFixed);
+      if (lambdaOutVaries)
+        afterScatter->addAttenuationExponents(lambdas, exponents);
+      else
+        fixedFactor = afterScatter->calculateAttenuation(lambdaFixed);
+      for (size_t j = 0; j < nbins; ++j) {
+        accumulate(i, j, fixedFactor * exp(-exponents[j]));
+      }
     }
   }
 
@@ -136,5 +126,35 @@ void MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng, c
                  [this](double v) -> double { return v / sqrt(static_cast<double>(m_nevents)); });
 }
 
+/**
+ * Generate the tracks before and after scattering at a random point in the interaction volume
+ * @param rng A reference to a PseudoRandomNumberGenerator
+ * @param scatterBounds The bounding box of the interaction volume
+ * @param finalPos Defines the final position of the neutron
+ * @param stats A statistics class to hold the statistics on the generated tracks
+ * @return The tracks before and after scattering
+ * @throws std::runtime_error if no valid track is found within the maximum number of attempts
+ */
+std::pair<std::shared_ptr<Geometry::Track>, std::shared_ptr<Geometry::Track>>
+MCAbsorptionStrategy::generateTracks(Kernel::PseudoRandomNumberGenerator &rng,
+                                     const Geometry::BoundingBox &scatterBounds, const Kernel::V3D &finalPos,
+                                     MCInteractionStatistics &stats) const {
+  for (size_t attempts = 0; attempts < m_maxScatterAttempts; ++attempts) {
+    const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
+    const auto [success, beforeScatter, afterScatter] =
+        m_scatterVol->calculateBeforeAfterTrack(rng, neutron.startPos, finalPos, stats);
+    if (success)
+      return {beforeScatter, afterScatter};
+  }
+  throw std::runtime_error("Unable to generate valid track through "
+                           "sample interaction volume after " +
+                           std::to_string(m_maxScatterAttempts) +
+                           " attempts. Try increasing the maximum "
+                           "threshold or if this does not help then "
+                           "please check the defined shape and, "
+                           "if defined, the gauge volume (both its shape "
+                           "and its intersection with the defined sample shape).");
+}
+
 } // namespace Algorithms
 } // namespace Mantid
@@ -147,6 +147,29 @@ public:
     TS_ASSERT_LESS_THAN_EQUALS(1, filesRemoved);
   }
 
+  void test_exec_Geometry_Cache_removes_cached_instruments() {
+    ClearCache alg;
+
+    auto instrumentDirs = ConfigService::Instance().getInstrumentDirectories();
+    std::filesystem::path localPath(instrumentDirs[0]);
+    std::filesystem::path instrumentsPath = localPath / "geometryCache" / "instruments";
+    createDirectory(instrumentsPath);
+    // create a file in the directory
+    std::filesystem::path testFilePath = instrumentsPath / "test_exec_Geometry_Cache.instrument";
+    std::ofstream testFile(testFilePath);
+    testFile.close();
+
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT(alg.isInitialized())
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("GeometryFileCache", true));
+    TS_ASSERT_THROWS_NOTHING(alg.execute(););
+    TS_ASSERT(alg.isExecuted());
+
+    TSM_ASSERT("The test file has not been deleted", !std::filesystem::exists(testFilePath));
+    int filesRemoved = alg.getProperty("FilesRemoved");
+    TS_ASSERT_LESS_THAN_EQUALS(1, filesRemoved);
+  }
+
   void test_exec_Usage_Cache() {
     ClearCache alg;
 
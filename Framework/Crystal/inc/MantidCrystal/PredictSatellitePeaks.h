@@ -13,6 +13,9 @@
 #include "MantidDataObjects/PeaksWorkspace.h"
 #include "MantidGeometry/Crystal/HKLFilterWavelength.h"
 #include "MantidGeometry/Crystal/IPeak.h"
+#include "MantidGeometry/Instrument/DetectorBoundingVolumeHierarchy.h"
+
+#include <memory>
 
 namespace Mantid {
 namespace Crystal {
@@ -56,6 +59,22 @@ private:
                                 const Kernel::V3D &satelliteHKL, const int runNumber,
                                 std::vector<std::vector<int>> &alreadyDonePeaks, const Kernel::V3D &mnp);
 
+  void addPendingPeaks(std::vector<std::vector<int>> &alreadyDonePeaks);
+
+  /// A predicted peak waiting for its detector to be found
+  struct PendingPeak {
+    std::shared_ptr<Geometry::IPeak> peak;
+    Kernel::Matrix<double> goniometer;
+    Kernel::V3D hkl;
+    Kernel::V3D satelliteHKL;
+    int runNumber;
+    Kernel::V3D mnp;
+  };
+
+  /// Number of predicted peaks whose detectors are found in one batch
+  const size_t PENDING_PEAKS_BATCH_SIZE = 4096;
+  std::vector<PendingPeak> m_pendingPeaks;
+  std::unique_ptr<Geometry::DetectorBoundingVolumeHierarchy> m_detectorHierarchy;
   const size_t MAX_NUMBER_HKLS = 10000000000;
   double m_qConventionFactor;
   API::IPeaksWorkspace_sptr Peaks;
@@ -13,8 +13,8 @@
 #include "MantidGeometry/Crystal/HKLGenerator.h"
 #include "MantidGeometry/Crystal/OrientedLattice.h"
 #include "MantidGeometry/Crystal/ReflectionCondition.h"
+#include "MantidGeometry/Instrument/DetectorBoundingVolumeHierarchy.h"
 #include "MantidGeometry/Instrument/Goniometer.h"
-#include "MantidGeometry/Objects/InstrumentRayTracer.h"
 #include "MantidKernel/ArrayLengthValidator.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/EnabledWhenProperty.h"
@@ -214,9 +214,8 @@ template <typename SearchStrategy>
 IPeaksWorkspace_sptr
 predictFractionalPeaks(Algorithm *const alg, const bool requirePeaksOnDetector, const PeaksWorkspace &inputPeaks,
                        const Mantid::Crystal::ModulationProperties &modulationProps, SearchStrategy searchStrategy) {
-  using Mantid::Geometry::InstrumentRayTracer;
+  using Mantid::Geometry::DetectorBoundingVolumeHierarchy;
 
-  const InstrumentRayTracer tracer(inputPeaks.getInstrument());
   const auto &UB = inputPeaks.sample().getOrientedLattice().getUB();
   const auto &offsets = modulationProps.offsets;
   auto outPeaks = createOutputWorkspace(inputPeaks, modulationProps);
@@ -224,6 +223,56 @@ predictFractionalPeaks(Algorithm *const alg, const bool requirePeaksOnDetector,
   std::vector<PeakHash> alreadyDonePeaks;
 
   const auto qConvention{Mantid::Crystal::qConventionFactor()};
+
+  // Candidate peaks are gathered so that their detectors can be found in one batch
+  struct CandidatePeak {
+    Peak_uptr peak;
+    V3D candidateHKL;
+    V3D currentIntHKL;
+    V3D mnp;
+    int runNumber;
+  };
+  constexpr size_t candidatesPerBatch{4096};
+  std::vector<CandidatePeak> candidates;
+  std::unique_ptr<DetectorBoundingVolumeHierarchy> hierarchy;
+  auto addCandidates = [&]() {
+    std::vector<bool> onDetector(candidates.size(), true);
+    if (requirePeaksOnDetector && !candidates.empty()) {
+      if (!hierarchy)
+        hierarchy =
+            std::make_unique<DetectorBoundingVolumeHierarchy>(inputPeaks.componentInfo(), inputPeaks.detectorInfo());
+      std::vector<Peak *> peaks;
+      peaks.reserve(candidates.size());
+      std::transform(candidates.cbegin(), candidates.cend(), std::back_inserter(peaks),
+                     [](const auto &candidate) { return candidate.peak.get(); });
+      onDetector = Peak::findDetectors(peaks, *hierarchy);
+    }
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      if (!onDetector[i])
+        continue;
+      auto &candidate = candidates[i];
+      const V3D &candidateHKL = candidate.candidateHKL;
+      GNU_DIAG_OFF("missing-braces")
+      PeakHash savedPeak{candidate.runNumber, boost::math::iround(1000.0 * candidateHKL[0]),
+                         boost::math::iround(1000.0 * candidateHKL[1]), boost::math::iround(1000.0 * candidateHKL[2])};
+      GNU_DIAG_ON("missing-braces")
+      auto it = find(alreadyDonePeaks.begin(), alreadyDonePeaks.end(), savedPeak);
+      if (it == alreadyDonePeaks.end())
+        alreadyDonePeaks.emplace_back(savedPeak);
+      else
+        continue;
+
+      auto &peak = candidate.peak;
+      peak->setHKL(candidateHKL * qConvention);
+      peak->setIntHKL(candidate.currentIntHKL * qConvention);
+      if (candidate.mnp != V3D(0., 0., 0.))
+        peak->setIntMNP(candidate.mnp);
+      peak->setRunNumber(candidate.runNumber);
+      outPeaks->addPeak(*peak);
+    }
+    candidates.clear();
+  };
+
   V3D currentHKL;
   DblMatrix gonioMatrix;
   int runNumber{0};
@@ -239,7 +288,8 @@ predictFractionalPeaks(Algorithm *const alg, const bool requirePeaksOnDetector,
 
       IPeak_uptr ipeak;
       try {
-        ipeak = inputPeaks.createPeak(qLab);
+        // Peaks required on a detector are traced in a batch by addCandidates
+        ipeak = requirePeaksOnDetector ? inputPeaks.createPeak(qLab, 1.0) : inputPeaks.createPeak(qLab);
       } catch (...) {
         // If we can't create a valid peak we have no choice but to skip
         // it
@@ -247,30 +297,16 @@ predictFractionalPeaks(Algorithm *const alg, const bool requirePeaksOnDetector,
       }
       Peak_uptr peak(static_cast<Peak *>(ipeak.release()));
       peak->setGoniometerMatrix(gonioMatrix);
-      if (requirePeaksOnDetector && peak->getDetectorID() < 0)
-        continue;
-      GNU_DIAG_OFF("missing-braces")
-      PeakHash savedPeak{runNumber, boost::math::iround(1000.0 * candidateHKL[0]),
-                         boost::math::iround(1000.0 * candidateHKL[1]), boost::math::iround(1000.0 * candidateHKL[2])};
-      GNU_DIAG_ON("missing-braces")
-      auto it = find(alreadyDonePeaks.begin(), alreadyDonePeaks.end(), savedPeak);
-      if (it == alreadyDonePeaks.end())
-        alreadyDonePeaks.emplace_back(savedPeak);
-      else
-        continue;
-
-      peak->setHKL(candidateHKL * qConvention);
-      peak->setIntHKL(currentIntHKL * qConvention);
       const double m{std::get<0>(mnpOffset)}, n{std::get<1>(mnpOffset)}, p{std::get<2>(mnpOffset)};
-      if (fabs(m) > 0. || fabs(n) > 0. || fabs(p) > 0.)
-        peak->setIntMNP(V3D(m, n, p));
-      peak->setRunNumber(runNumber);
-      outPeaks->addPeak(*peak);
+      candidates.emplace_back(CandidatePeak{std::move(peak), candidateHKL, currentIntHKL, V3D(m, n, p), runNumber});
     }
+    if (candidates.size() >= candidatesPerBatch)
+      addCandidates();
     progressReporter.report();
     if (!searchStrategy.nextHKL(&currentHKL, &gonioMatrix, &runNumber))
       break;
   }
+  addCandidates();
 
   return outPeaks;
 }
@@ -20,7 +20,6 @@
 #include "MantidGeometry/Crystal/BasicHKLFilters.h"
 #include "MantidGeometry/Crystal/HKLGenerator.h"
 #include "MantidGeometry/Crystal/OrientedLattice.h"
-#include "MantidGeometry/Objects/InstrumentRayTracer.h"
 #include "MantidKernel/EnabledWhenProperty.h"
 #include <boost/math/special_functions/round.hpp>
 
@@ -178,6 +177,8 @@ void PredictSatellitePeaks::exec() {
                      alreadyDonePeaks);
     }
   }
+  addPendingPeaks(alreadyDonePeaks);
+  m_detectorHierarchy.reset();
   // Sort peaks by run number so that peaks with equal goniometer matrices are
   // adjacent
   std::vector<std::pair<std::string, bool>> criteria;
@@ -266,6 +267,8 @@ void PredictSatellitePeaks::exec_peaks() {
                      notOrderZero, alreadyDonePeaks);
     }
   }
+  addPendingPeaks(alreadyDonePeaks);
+  m_detectorHierarchy.reset();
   // Sort peaks by run number so that peaks with equal goniometer matrices are
   // adjacent
   std::vector<std::pair<std::string, bool>> criteria;
@@ -406,39 +409,59 @@ void PredictSatellitePeaks::addPeakToOutputWorkspace(const std::shared_ptr<IPeak
   if (satellite_iPeak == nullptr)
     return;
 
-  const workspace_type_enum workspace_type = determineWorkspaceType(Peaks);
-
-  if (workspace_type == workspace_type_enum::regular_peaks) {
-    const Geometry::InstrumentRayTracer tracer(Peaks->getInstrument());
+  m_pendingPeaks.emplace_back(PendingPeak{satellite_iPeak, peak_goniometer_matrix, hkl, satelliteHKL, runNumber, mnp});
+  if (m_pendingPeaks.size() >= PENDING_PEAKS_BATCH_SIZE)
+    addPendingPeaks(alreadyDonePeaks);
+}
 
-    const std::shared_ptr<Peak> peak = std::dynamic_pointer_cast<Peak>(satellite_iPeak);
+/** Find the detectors of the pending peaks in one batch and add those that
+ * hit a detector, and were not already added, to the output workspace in the
+ * order they were predicted.
+ *
+ * @param alreadyDonePeaks :: run number and hkl of the peaks already added
+ */
+void PredictSatellitePeaks::addPendingPeaks(std::vector<std::vector<int>> &alreadyDonePeaks) {
+  if (m_pendingPeaks.empty())
+    return;
 
-    if (!peak->findDetector(tracer))
-      return;
+  std::vector<bool> onDetector(m_pendingPeaks.size(), true);
+  if (determineWorkspaceType(Peaks) == workspace_type_enum::regular_peaks) {
+    if (!m_detectorHierarchy)
+      m_detectorHierarchy =
+          std::make_unique<Geometry::DetectorBoundingVolumeHierarchy>(Peaks->componentInfo(), Peaks->detectorInfo());
+    std::vector<Peak *> peaks;
+    peaks.reserve(m_pendingPeaks.size());
+    std::transform(m_pendingPeaks.cbegin(), m_pendingPeaks.cend(), std::back_inserter(peaks),
+                   [](const auto &pending) { return dynamic_cast<Peak *>(pending.peak.get()); });
+    onDetector = Peak::findDetectors(peaks, *m_detectorHierarchy);
   }
 
-  const std::vector<int> savPk{runNumber, boost::math::iround(1000.0 * satelliteHKL[0]),
-                               boost::math::iround(1000.0 * satelliteHKL[1]),
-                               boost::math::iround(1000.0 * satelliteHKL[2])};
-
-  const bool foundPeak = binary_search(alreadyDonePeaks.begin(), alreadyDonePeaks.end(), savPk);
+  for (size_t i = 0; i < m_pendingPeaks.size(); ++i) {
+    if (!onDetector[i])
+      continue;
+    const auto &pending = m_pendingPeaks[i];
+    const std::vector<int> savPk{pending.runNumber, boost::math::iround(1000.0 * pending.satelliteHKL[0]),
+                                 boost::math::iround(1000.0 * pending.satelliteHKL[1]),
+                                 boost::math::iround(1000.0 * pending.satelliteHKL[2])};
 
-  if (!foundPeak) {
-    alreadyDonePeaks.emplace_back(savPk);
-  }
+    const bool foundPeak = binary_search(alreadyDonePeaks.begin(), alreadyDonePeaks.end(), savPk);
 
-  else
-    return;
+    if (!foundPeak) {
+      alreadyDonePeaks.emplace_back(savPk);
+    }
 
-  satellite_iPeak->setGoniometerMatrix(peak_goniometer_matrix);
-  satellite_iPeak->setHKL(satelliteHKL * m_qConventionFactor);
-  satellite_iPeak->setIntHKL(hkl * m_qConventionFactor);
-  satellite_iPeak->setRunNumber(runNumber);
-  satellite_iPeak->setIntMNP(mnp * m_qConventionFactor);
+    else
+      continue;
 
-  outPeaks->addPeak(*satellite_iPeak);
+    pending.peak->setGoniometerMatrix(pending.goniometer);
+    pending.peak->setHKL(pending.satelliteHKL * m_qConventionFactor);
+    pending.peak->setIntHKL(pending.hkl * m_qConventionFactor);
+    pending.peak->setRunNumber(pending.runNumber);
+    pending.peak->setIntMNP(pending.mnp * m_qConventionFactor);
 
-  return;
+    outPeaks->addPeak(*pending.peak);
+  }
+  m_pendingPeaks.clear();
 }
 
 V3D PredictSatellitePeaks::getOffsetVector(const std::string &label) {
@@ -0,0 +1,45 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+
+#pragma once
+
+#include "MantidDataHandling/DllConfig.h"
+#include <cstddef>
+#include <vector>
+
+namespace Mantid::DataHandling::AlignAndFocusPowderSlim {
+
+/**
+ * Class that finds which bin a time-of-flight falls into. Linear and logarithmic bin edges, as created by
+ * Kernel::VectorHelper::createAxisFromRebinParams, are recognised in the constructor and the bin index is estimated in
+ * closed form then corrected against the bin edges. Any other bin edges fall back to a binary search. The bin edges
+ * are not copied so they must outlive this object.
+ */
+class MANTID_DATAHANDLING_DLL BinFinder {
+public:
+  enum class Mode { LINEAR, LOGARITHMIC, TABLE };
+
+  explicit BinFinder(const std::vector<double> *binedges);
+
+  Mode mode() const;
+
+  size_t findBin(const double tof) const;
+  void findBins(const double *tofs, size_t *bins, const size_t count) const;
+
+private:
+  size_t correctBin(const double tof, size_t bin) const;
+
+  const std::vector<double> *m_binedges;
+  Mode m_mode;
+  /// closed form bin index is tof * m_divisor - m_offset, or log(tof) * m_divisor - m_offset
+  double m_divisor;
+  double m_offset;
+  /// index of the last bin which may be narrower than the others
+  double m_lastBin;
+};
+
+} // namespace Mantid::DataHandling::AlignAndFocusPowderSlim
@@ -26,8 +26,8 @@ class ProcessBankTask : public ProcessBankTaskBase {
 public:
   ProcessBankTask(std::vector<std::string> &bankEntryNames, H5::H5File &h5file, std::shared_ptr<NexusLoader> loader,
                   SpectraProcessingData &processingData, const BankCalibrationFactory &calibFactory,
-                  const size_t events_per_chunk, const size_t grainsize_event,
-                  std::shared_ptr<API::Progress> &progress);
+                  const size_t events_per_chunk, const size_t grainsize_event, std::shared_ptr<API::Progress> &progress,
+                  const size_t read_ahead_chunks = 1);
 
   void operator()(const tbb::blocked_range<size_t> &range) const;
 
@@ -39,5 +39,7 @@ private:
   /// number of events to histogram in a single thread
   const size_t m_grainsize_event;
   std::shared_ptr<API::Progress> m_progress;
+  /// number of chunks to read from disk while the current one is being histogrammed
+  const size_t m_read_ahead_chunks;
 };
 } // namespace Mantid::DataHandling::AlignAndFocusPowderSlim
@@ -47,6 +47,19 @@ private:
   const BankCalibrationFactory &m_calibFactory;
 };
 
+/// The event ranges that are read from disk at one time
+struct EventChunk {
+  std::vector<size_t> offsets;
+  std::vector<size_t> slabsizes;
+  size_t total_events{0};
+  /// target of each range and where its events are in the chunk, only filled when splitting by target
+  std::vector<std::pair<int, EventROI>> relative_target_ranges;
+};
+
+std::vector<EventChunk> splitIntoChunks(std::stack<EventROI> eventRanges, const size_t events_per_chunk);
+std::vector<EventChunk> splitIntoChunks(std::stack<std::pair<int, EventROI>> eventSplitRanges,
+                                        const size_t events_per_chunk);
+
 std::string toLogString(const std::string &bankName, const size_t total_events_to_read,
                         const std::vector<size_t> &offsets, const std::vector<size_t> &slabsizes);
 } // namespace Mantid::DataHandling::AlignAndFocusPowderSlim
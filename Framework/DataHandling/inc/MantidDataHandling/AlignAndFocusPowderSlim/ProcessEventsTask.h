@@ -8,22 +8,27 @@
 #pragma once
 
 #include "MantidDataHandling/AlignAndFocusPowderSlim/BankCalibration.h"
+#include "MantidDataHandling/AlignAndFocusPowderSlim/BinFinder.h"
+#include <array>
 #include <ranges>
 #include <tbb/tbb.h>
 #include <vector>
 
 namespace Mantid::DataHandling::AlignAndFocusPowderSlim {
 
+/// Number of calibrated events collected before their bins are found together
+constexpr size_t EVENT_BLOCK_SIZE{512};
+
 template <typename DetIDsVector, typename TofVector> class ProcessEventsTask {
 public:
   ProcessEventsTask(DetIDsVector *detids, TofVector *tofs, const BankCalibration *calibration,
                     const std::vector<double> *binedges)
       : y_temp(binedges->size() - 1, 0), m_detids(detids), m_tofs(tofs), m_calibration(calibration),
-        m_binedges(binedges) {}
+        m_binedges(binedges), m_binfinder(binedges) {}
 
   ProcessEventsTask(ProcessEventsTask &other, tbb::split)
       : y_temp(other.y_temp.size(), 0), m_detids(other.m_detids), m_tofs(other.m_tofs),
-        m_calibration(other.m_calibration), m_binedges(other.m_binedges) {}
+        m_calibration(other.m_calibration), m_binedges(other.m_binedges), m_binfinder(other.m_binfinder) {}
 
   void operator()(const tbb::blocked_range<size_t> &range) {
     if (m_calibration->empty()) {
@@ -31,31 +36,38 @@ public:
     }
     // Cache values to reduce number of function calls
     const auto &range_end = range.end();
-    const auto &binedges_cbegin = m_binedges->cbegin();
-    const auto &binedges_cend = m_binedges->cend();
     const auto &tof_min = m_binedges->front();
     const auto &tof_max = m_binedges->back();
 
+    // calibrated time-of-flight and bin index of the events in the current block that are inside the histogram
+    std::array<double, EVENT_BLOCK_SIZE> tof_block;
+    std::array<size_t, EVENT_BLOCK_SIZE> bin_block;
+
     // Calibrate and histogram the data
     auto detid_iter = std::ranges::next(m_detids->begin(), range.begin());
     auto tof_iter = std::ranges::next(m_tofs->begin(), range.begin());
-    for (size_t i = range.begin(); i < range_end; ++i) {
-      const auto &detid = *detid_iter;
-      const auto &calib_factor = m_calibration->value_calibration(detid);
-      if (calib_factor < IGNORE_PIXEL) {
-        // Apply calibration
-        const double &tof = static_cast<double>(*tof_iter) * calib_factor;
-        if ((tof < tof_max) && (!(tof < tof_min))) { // check against max first to allow skipping second
-          // Find the bin index using binary search
-          const auto &it = std::upper_bound(binedges_cbegin, binedges_cend, tof);
-
-          // Increment the count if a bin was found
-          const auto &bin = static_cast<size_t>(std::distance(binedges_cbegin, it) - 1);
-          y_temp[bin]++;
+    for (size_t block_start = range.begin(); block_start < range_end; block_start += EVENT_BLOCK_SIZE) {
+      const auto block_end = std::min(block_start + EVENT_BLOCK_SIZE, range_end);
+      size_t num_in_block = 0;
+      for (size_t i = block_start; i < block_end; ++i) {
+        const auto &detid = *detid_iter;
+        const auto &calib_factor = m_calibration->value_calibration(detid);
+        if (calib_factor < IGNORE_PIXEL) {
+          // Apply calibration
+          const double &tof = static_cast<double>(*tof_iter) * calib_factor;
+          if ((tof < tof_max) && (!(tof < tof_min))) { // check against max first to allow skipping second
+            tof_block[num_in_block] = tof;
+            ++num_in_block;
+          }
         }
+        ++detid_iter;
+        ++tof_iter;
       }
-      ++detid_iter;
-      ++tof_iter;
+
+      // Find the bin indices for the whole block then increment the counts
+      m_binfinder.findBins(tof_block.data(), bin_block.data(), num_in_block);
+      for (size_t j = 0; j < num_in_block; ++j)
+        y_temp[bin_block[j]]++;
     }
   }
 
@@ -72,6 +84,7 @@ private:
   TofVector *m_tofs;
   const BankCalibration *m_calibration;
   const std::vector<double> *m_binedges;
+  BinFinder m_binfinder;
 };
 
 } // namespace Mantid::DataHandling::AlignAndFocusPowderSlim
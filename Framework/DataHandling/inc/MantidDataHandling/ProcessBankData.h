@@ -11,6 +11,7 @@
 #include "MantidKernel/Task.h"
 
 #include <memory>
+#include <vector>
 
 namespace Mantid {
 namespace API {
@@ -18,6 +19,20 @@ class Progress;
 }
 namespace DataHandling {
 class DefaultEventLoader;
+class PulseIndexer;
+
+/// Summary of the events that were found while processing a bank
+struct BankEventStatistics {
+  /// Local tof limits
+  double shortestTof;
+  double longestTof;
+  /// A count of "bad" TOFs that were too high
+  size_t badTofs{0};
+  /// Events with a detector ID that has no event list
+  size_t discardedEvents{0};
+  /// Which detector IDs were touched, index is detector ID minus the minimum detector ID
+  std::vector<bool> usedDetIds;
+};
 
 /** This task does the disk IO from loading the NXS file,
  * and so will be on a disk IO mutex */
@@ -51,7 +66,9 @@ public:
 
 private:
   size_t getWorkspaceIndexFromPixelID(const detid_t pixID);
-  void preCountAndReserveMem();
+  template <typename EventType, typename EventFactory>
+  void scatterEvents(const PulseIndexer &pulseIndexer, std::vector<std::vector<std::vector<EventType> *>> &eventVectors,
+                     const EventFactory &createEvent, BankEventStatistics &statistics);
 
   /// Algorithm being run
   DefaultEventLoader &m_loader;
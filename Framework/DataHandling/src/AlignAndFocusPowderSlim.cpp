@@ -216,6 +216,14 @@ void AlignAndFocusPowderSlim::init() {
       std::make_unique<PropertyWithValue<int>>(PropertyNames::EVENTS_PER_THREAD, 1000, positiveIntValidator),
       "Number of events to read in a single thread. Higher means less threads are created.");
   setPropertyGroup(PropertyNames::EVENTS_PER_THREAD, CHUNKING_PARAM_GROUP);
+  auto nonNegativeIntValidator = std::make_shared<Mantid::Kernel::BoundedValidator<int>>();
+  nonNegativeIntValidator->setLower(0);
+  declareProperty(
+      std::make_unique<PropertyWithValue<int>>(PropertyNames::READ_AHEAD_CHUNKS, 1, nonNegativeIntValidator),
+      "Number of chunks of " + PropertyNames::READ_SIZE_FROM_DISK +
+          " events to read from disk while the current chunk is being histogrammed. "
+          "Zero reads and histograms in turn.");
+  setPropertyGroup(PropertyNames::READ_AHEAD_CHUNKS, CHUNKING_PARAM_GROUP);
 
   // load single bank
   declareProperty(
@@ -454,6 +462,7 @@ void AlignAndFocusPowderSlim::exec() {
   // threaded processing of the banks
   const int DISK_CHUNK = getProperty(PropertyNames::READ_SIZE_FROM_DISK);
   const int GRAINSIZE_EVENTS = getProperty(PropertyNames::EVENTS_PER_THREAD);
+  const int READ_AHEAD_CHUNKS = getProperty(PropertyNames::READ_AHEAD_CHUNKS);
   g_log.debug() << (DISK_CHUNK / GRAINSIZE_EVENTS) << " threads per chunk\n";
 
   // get pulse times from frequency log on workspace. We use this in several places.
@@ -472,7 +481,7 @@ void AlignAndFocusPowderSlim::exec() {
 
     auto progress = std::make_shared<API::Progress>(this, .17, .9, num_banks_to_read);
     ProcessBankTask task(bankEntryNames, h5file, loader, processingData, calibFactory, static_cast<size_t>(DISK_CHUNK),
-                         static_cast<size_t>(GRAINSIZE_EVENTS), progress);
+                         static_cast<size_t>(GRAINSIZE_EVENTS), progress, static_cast<size_t>(READ_AHEAD_CHUNKS));
     // generate threads only if appropriate
     if (num_banks_to_read > 1) {
       tbb::parallel_for(tbb::blocked_range<size_t>(0, num_banks_to_read), task);
@@ -0,0 +1,122 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+
+#include "MantidDataHandling/AlignAndFocusPowderSlim/BinFinder.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Mantid::DataHandling::AlignAndFocusPowderSlim {
+
+namespace {
+/**
+ * Whether the bin edges are uniformly spaced after applying a transformation. Only the interior edges at the middle
+ * and end are checked against the width of the first bin, as the last bin can be narrower than the rest. This is only
+ * used to pick the closed form estimate; BinFinder::correctBin makes the answer exact regardless.
+ */
+template <typename Transform>
+bool isUniform(const std::vector<double> &binedges, const double width, Transform &&transform) {
+  if (!(width > 0.))
+    return false;
+  const auto start = transform(binedges.front());
+  const auto lastInterior = binedges.size() - 2;
+  for (const auto index : {lastInterior / 2, lastInterior}) {
+    const auto expected = start + static_cast<double>(index) * width;
+    if (std::abs(transform(binedges[index]) - expected) > 0.5 * width)
+      return false;
+  }
+  return true;
+}
+} // namespace
+
+BinFinder::BinFinder(const std::vector<double> *binedges)
+    : m_binedges(binedges), m_mode(Mode::TABLE), m_divisor(0.), m_offset(0.), m_lastBin(0.) {
+  if (binedges->size() < 2)
+    throw std::runtime_error("BinFinder requires at least two bin edges");
+  m_lastBin = static_cast<double>(binedges->size() - 2);
+
+  // with only one or two bins a binary search is as fast as anything else
+  if (binedges->size() < 4)
+    return;
+
+  const auto &x0 = binedges->front();
+  const auto &x1 = (*binedges)[1];
+  const auto identity = [](const double value) { return value; };
+  const auto logarithm = [](const double value) { return std::log(value); };
+  if (isUniform(*binedges, x1 - x0, identity)) {
+    m_mode = Mode::LINEAR;
+    m_divisor = 1. / (x1 - x0);
+    m_offset = x0 * m_divisor;
+  } else if (x0 > 0. && isUniform(*binedges, std::log(x1 / x0), logarithm)) {
+    m_mode = Mode::LOGARITHMIC;
+    m_divisor = 1. / std::log(x1 / x0);
+    m_offset = std::log(x0) * m_divisor;
+  }
+}
+
+BinFinder::Mode BinFinder::mode() const { return m_mode; }
+
+/**
+ * Move the estimated bin until the time-of-flight is inside of it.
+ */
+size_t BinFinder::correctBin(const double tof, size_t bin) const {
+  const auto &binedges = *m_binedges;
+  while (bin > 0 && tof < binedges[bin])
+    --bin;
+  const auto lastBin = binedges.size() - 2;
+  while (bin < lastBin && !(tof < binedges[bin + 1]))
+    ++bin;
+  return bin;
+}
+
+/**
+ * This assumes that the time-of-flight is within [binedges.front(), binedges.back()).
+ */
+size_t BinFinder::findBin(const double tof) const {
+  size_t bin = 0;
+  findBins(&tof, &bin, 1);
+  return bin;
+}
+
+/**
+ * Find the bins for a contiguous block of values. The closed form estimates are calculated for the whole block in a
+ * single loop so the compiler can vectorize it, then each estimate is corrected against the bin edges. This assumes
+ * that all of the time-of-flight values are within [binedges.front(), binedges.back()).
+ *
+ * @param tofs Values to find the bins of
+ * @param bins Output bin indices
+ * @param count Number of values in the block
+ */
+void BinFinder::findBins(const double *tofs, size_t *bins, const size_t count) const {
+  const auto divisor = m_divisor;
+  const auto offset = m_offset;
+  const auto lastBin = m_lastBin;
+
+  switch (m_mode) {
+  case Mode::LINEAR:
+    for (size_t i = 0; i < count; ++i)
+      bins[i] = static_cast<size_t>(std::clamp(tofs[i] * divisor - offset, 0., lastBin));
+    break;
+  case Mode::LOGARITHMIC:
+    for (size_t i = 0; i < count; ++i)
+      bins[i] = static_cast<size_t>(std::clamp(std::log(tofs[i]) * divisor - offset, 0., lastBin));
+    break;
+  case Mode::TABLE: {
+    const auto &binedges = *m_binedges;
+    for (size_t i = 0; i < count; ++i) {
+      const auto it = std::upper_bound(binedges.cbegin(), binedges.cend(), tofs[i]);
+      bins[i] = static_cast<size_t>(std::distance(binedges.cbegin(), it) - 1);
+    }
+    return; // binary search is already exact
+  }
+  }
+
+  for (size_t i = 0; i < count; ++i)
+    bins[i] = this->correctBin(tofs[i], bins[i]);
+}
+
+} // namespace Mantid::DataHandling::AlignAndFocusPowderSlim
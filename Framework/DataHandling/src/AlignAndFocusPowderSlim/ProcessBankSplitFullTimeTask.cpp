@@ -76,51 +76,17 @@ void ProcessBankSplitFullTimeTask::operator()(const tbb::blocked_range<size_t> &
     auto pulse_times_idx = std::make_unique<std::vector<size_t>>();     // index into pulse_times for every event
 
     // read parts of the bank at a time until all events are processed
-    while (!eventRanges.empty()) {
-      // Create offsets and slab sizes for the next chunk of events.
-      // This will read at most m_events_per_chunk events from the file
-      // and will split the ranges if necessary for the next iteration.
-      std::vector<size_t> offsets;
-      std::vector<size_t> slabsizes;
-
-      size_t total_events_to_read = 0;
-      // Process the event ranges until we reach the desired number of events to read or run out of ranges
-      while (!eventRanges.empty() && total_events_to_read < m_events_per_chunk) {
-        // Get the next event range from the stack
-        auto eventRange = eventRanges.top();
-        eventRanges.pop();
-
-        size_t range_size = eventRange.second - eventRange.first;
-        size_t remaining_chunk = m_events_per_chunk - total_events_to_read;
-
-        // If the range size is larger than the remaining chunk, we need to split it
-        if (range_size > remaining_chunk) {
-          // Split the range: process only part of it now, push the rest back for later
-          offsets.push_back(eventRange.first);
-          slabsizes.push_back(remaining_chunk);
-          total_events_to_read += remaining_chunk;
-          // Push the remainder of the range back to the front for next iteration
-          eventRanges.emplace(eventRange.first + remaining_chunk, eventRange.second);
-          break;
-        } else {
-          offsets.push_back(eventRange.first);
-          slabsizes.push_back(range_size);
-          total_events_to_read += range_size;
-          // Continue to next range
-        }
-      }
+    for (const auto &chunk : splitIntoChunks(std::move(eventRanges), m_events_per_chunk)) {
+      const auto &offsets = chunk.offsets;
+      const auto &slabsizes = chunk.slabsizes;
 
       // log the event ranges being processed
-      g_log.debug(toLogString(bankName, total_events_to_read, offsets, slabsizes));
-
-      if (total_events_to_read == 0) {
-        continue; // nothing to do
-      }
+      g_log.debug(toLogString(bankName, chunk.total_events, offsets, slabsizes));
 
       // load detid and tof at the same time
       this->loadEvents(detID_SDS, tof_SDS, offsets, slabsizes, event_detid, event_time_of_flight);
 
-      pulse_times_idx->resize(total_events_to_read);
+      pulse_times_idx->resize(chunk.total_events);
       // get the pulsetime of every event, event_index maps the first event of each pulse
       size_t pos = 0;
       auto event_index_it = event_index->cbegin();
@@ -71,54 +71,12 @@ void ProcessBankSplitTask::operator()(const tbb::blocked_range<size_t> &range) c
     auto event_time_of_flight = std::make_unique<std::vector<float>>(); // float for ORNL nexus files
 
     // read parts of the bank at a time until all events are processed
-    while (!eventSplitRanges.empty()) {
-      // Create offsets and slab sizes for the next chunk of events.
-      // This will read at most m_events_per_chunk events from the file
-      // and will split the ranges if necessary for the next iteration.
-      std::vector<size_t> offsets;
-      std::vector<size_t> slabsizes;
-      std::vector<std::pair<int, EventROI>> relative_target_ranges;
-
-      size_t total_events_to_read = 0;
-      // Process the event ranges until we reach the desired number of events to read or run out of ranges
-      while (!eventSplitRanges.empty() && total_events_to_read < m_events_per_chunk) {
-        // Get the next event range from the stack
-        auto [target, eventRange] = eventSplitRanges.top();
-        eventSplitRanges.pop();
-
-        size_t range_size = eventRange.second - eventRange.first;
-        size_t remaining_chunk = m_events_per_chunk - total_events_to_read;
-
-        // If the range size is larger than the remaining chunk, we need to split it
-        if (range_size > remaining_chunk) {
-          // Split the range: process only part of it now, push the rest back for later
-          relative_target_ranges.emplace_back(target,
-                                              EventROI(total_events_to_read, total_events_to_read + remaining_chunk));
-          offsets.push_back(eventRange.first);
-          slabsizes.push_back(remaining_chunk);
-          total_events_to_read += remaining_chunk;
-          // Push the remainder of the range back to the front for next iteration
-          eventSplitRanges.emplace(target, EventROI(eventRange.first + remaining_chunk, eventRange.second));
-          break;
-        } else {
-          relative_target_ranges.emplace_back(target,
-                                              EventROI(total_events_to_read, total_events_to_read + range_size));
-          offsets.push_back(eventRange.first);
-          slabsizes.push_back(range_size);
-          total_events_to_read += range_size;
-          // Continue to next range
-        }
-      }
-
+    for (const auto &chunk : splitIntoChunks(std::move(eventSplitRanges), m_events_per_chunk)) {
       // log the event ranges being processed
-      g_log.debug(toLogString(bankName, total_events_to_read, offsets, slabsizes));
-
-      if (total_events_to_read == 0) {
-        continue; // nothing to do
-      }
+      g_log.debug(toLogString(bankName, chunk.total_events, chunk.offsets, chunk.slabsizes));
 
       // load detid and tof at the same time
-      this->loadEvents(detID_SDS, tof_SDS, offsets, slabsizes, event_detid, event_time_of_flight);
+      this->loadEvents(detID_SDS, tof_SDS, chunk.offsets, chunk.slabsizes, event_detid, event_time_of_flight);
 
       // loop over targets
       tbb::parallel_for(
@@ -128,7 +86,7 @@ void ProcessBankSplitTask::operator()(const tbb::blocked_range<size_t> &range) c
 
               // Precompute indices for this target
               std::vector<size_t> indices;
-              for (const auto &pair : relative_target_ranges) {
+              for (const auto &pair : chunk.relative_target_ranges) {
                 if (pair.first == static_cast<int>(i)) {
                   auto [start, end] = pair.second;
                   for (size_t k = start; k < end; ++k) {
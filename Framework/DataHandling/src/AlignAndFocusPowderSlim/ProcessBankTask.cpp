@@ -13,6 +13,9 @@
 #include "MantidNexus/H5Util.h"
 #include "tbb/parallel_for.h"
 #include "tbb/parallel_reduce.h"
+#include "tbb/task_group.h"
+
+#include <deque>
 
 namespace Mantid::DataHandling::AlignAndFocusPowderSlim {
 
@@ -21,13 +24,27 @@ namespace {
 // Logger for this class
 auto g_log = Kernel::Logger("ProcessBankTask");
 
+/// Detector ids and time-of-flight of one chunk of events
+struct EventBuffers {
+  std::unique_ptr<std::vector<uint32_t>> detids;
+  std::unique_ptr<std::vector<float>> tofs;
+};
+
+/// A chunk of events being read into its buffers as a TBB task
+struct ChunkRead {
+  tbb::task_group reading;
+  EventBuffers buffers;
+};
+
 } // namespace
 ProcessBankTask::ProcessBankTask(std::vector<std::string> &bankEntryNames, H5::H5File &h5file,
                                  std::shared_ptr<NexusLoader> loader, SpectraProcessingData &processingData,
                                  const BankCalibrationFactory &calibFactory, const size_t events_per_chunk,
-                                 const size_t grainsize_event, std::shared_ptr<API::Progress> &progress)
+                                 const size_t grainsize_event, std::shared_ptr<API::Progress> &progress,
+                                 const size_t read_ahead_chunks)
     : ProcessBankTaskBase(bankEntryNames, loader, calibFactory), m_h5file(h5file), m_processingData(processingData),
-      m_events_per_chunk(events_per_chunk), m_grainsize_event(grainsize_event), m_progress(progress) {}
+      m_events_per_chunk(events_per_chunk), m_grainsize_event(grainsize_event), m_progress(progress),
+      m_read_ahead_chunks(read_ahead_chunks) {}
 
 void ProcessBankTask::operator()(const tbb::blocked_range<size_t> &range) const {
   auto entry = m_h5file.openGroup("entry"); // type=NXentry
@@ -64,59 +81,57 @@ void ProcessBankTask::operator()(const tbb::blocked_range<size_t> &range) const
       continue;
     }
 
-    auto eventRanges = this->getEventIndexRanges(event_group, total_events);
+    // determine which events to read from disk at one time
+    const auto chunks = splitIntoChunks(this->getEventIndexRanges(event_group, total_events), m_events_per_chunk);
 
     // get handle to the detector IDs
     auto detID_SDS = event_group.openDataSet(NxsFieldNames::DETID);
 
-    // declare arrays once so memory can be reused
-    auto event_detid = std::make_unique<std::vector<uint32_t>>();       // uint32 for ORNL nexus file
-    auto event_time_of_flight = std::make_unique<std::vector<float>>(); // float for ORNL nexus files
+    // buffers that have been processed and can be reused for reading the next chunk
+    std::vector<EventBuffers> free_buffers;
+    // chunks being read in the background, in the order they will be processed. A deque never moves its elements
+    // when adding at the back or removing from the front, so the reading tasks can write straight into the buffers
+    std::deque<ChunkRead> chunks_reading;
+
+    // start reading the chunk of events into a buffer as a task in the TBB thread pool
+    size_t next_chunk = 0;
+    auto start_reading_next_chunk = [&]() {
+      auto &read = chunks_reading.emplace_back();
+      if (free_buffers.empty()) {
+        // declare arrays once so memory can be reused
+        read.buffers.detids = std::make_unique<std::vector<uint32_t>>(); // uint32 for ORNL nexus file
+        read.buffers.tofs = std::make_unique<std::vector<float>>();      // float for ORNL nexus files
+      } else {
+        read.buffers = std::move(free_buffers.back());
+        free_buffers.pop_back();
+      }
+      const auto &chunk = chunks[next_chunk++];
+      read.reading.run([this, &detID_SDS, &tof_SDS, &chunk, &buffers = read.buffers]() {
+        // load detid and tof at the same time
+        this->loadEvents(detID_SDS, tof_SDS, chunk.offsets, chunk.slabsizes, buffers.detids, buffers.tofs);
+      });
+    };
+
+    if (!chunks.empty())
+      start_reading_next_chunk();
 
     // read parts of the bank at a time until all events are processed
-    while (!eventRanges.empty()) {
-      // Create offsets and slab sizes for the next chunk of events.
-      // This will read at most m_events_per_chunk events from the file
-      // and will split the ranges if necessary for the next iteration.
-      std::vector<size_t> offsets;
-      std::vector<size_t> slabsizes;
-
-      size_t total_events_to_read = 0;
-      // Process the event ranges until we reach the desired number of events to read or run out of ranges
-      while (!eventRanges.empty() && total_events_to_read < m_events_per_chunk) {
-        // Get the next event range from the stack
-        auto eventRange = eventRanges.top();
-        eventRanges.pop();
-
-        size_t range_size = eventRange.second - eventRange.first;
-        size_t remaining_chunk = m_events_per_chunk - total_events_to_read;
-
-        // If the range size is larger than the remaining chunk, we need to split it
-        if (range_size > remaining_chunk) {
-          // Split the range: process only part of it now, push the rest back for later
-          offsets.push_back(eventRange.first);
-          slabsizes.push_back(remaining_chunk);
-          total_events_to_read += remaining_chunk;
-          // Push the remainder of the range back to the front for next iteration
-          eventRanges.emplace(eventRange.first + remaining_chunk, eventRange.second);
-          break;
-        } else {
-          offsets.push_back(eventRange.first);
-          slabsizes.push_back(range_size);
-          total_events_to_read += range_size;
-          // Continue to next range
-        }
-      }
+    while (!chunks_reading.empty()) {
+      const auto &chunk = chunks[next_chunk - chunks_reading.size()];
+      // runs the read on this thread if no other thread has started it yet
+      chunks_reading.front().reading.wait();
+      auto buffers = std::move(chunks_reading.front().buffers);
+      chunks_reading.pop_front();
 
-      // log the event ranges being processed
-      g_log.debug(toLogString(bankName, total_events_to_read, offsets, slabsizes));
+      // keep the disk busy with the following chunks while this one is histogrammed
+      while (next_chunk < chunks.size() && chunks_reading.size() < m_read_ahead_chunks)
+        start_reading_next_chunk();
 
-      if (total_events_to_read == 0) {
-        continue; // nothing to do
-      }
+      // log the event ranges being processed
+      g_log.debug(toLogString(bankName, chunk.total_events, chunk.offsets, chunk.slabsizes));
 
-      // load detid and tof at the same time
-      this->loadEvents(detID_SDS, tof_SDS, offsets, slabsizes, event_detid, event_time_of_flight);
+      const auto &event_detid = buffers.detids;
+      const auto &event_time_of_flight = buffers.tofs;
 
       // Loop over all output spectra / groups
       tbb::parallel_for(
@@ -137,6 +152,12 @@ void ProcessBankTask::operator()(const tbb::blocked_range<size_t> &range) const
               }
             }
           });
+
+      free_buffers.push_back(std::move(buffers));
+
+      // without read ahead the next chunk is only read once this one has been histogrammed
+      if (chunks_reading.empty() && next_chunk < chunks.size())
+        start_reading_next_chunk();
     }
 
     g_log.debug() << bankName << " stop " << timer << std::endl;
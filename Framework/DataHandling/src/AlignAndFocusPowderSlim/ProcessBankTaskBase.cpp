@@ -52,6 +52,83 @@ std::stack<std::pair<int, EventROI>> ProcessBankTaskBase::getEventIndexSplitRang
   return m_loader->getEventIndexSplitRanges(event_group, number_events);
 }
 
+namespace {
+// event ranges with or without the target they belong to
+const EventROI &eventRangeOf(const EventROI &range) { return range; }
+const EventROI &eventRangeOf(const std::pair<int, EventROI> &range) { return range.second; }
+
+EventROI withEventRange(const EventROI &, const EventROI &eventRange) { return eventRange; }
+std::pair<int, EventROI> withEventRange(const std::pair<int, EventROI> &range, const EventROI &eventRange) {
+  return {range.first, eventRange};
+}
+
+void addTargetRange(EventChunk &, const EventROI &, const size_t, const size_t) {}
+void addTargetRange(EventChunk &chunk, const std::pair<int, EventROI> &range, const size_t start, const size_t size) {
+  chunk.relative_target_ranges.emplace_back(range.first, EventROI(start, start + size));
+}
+
+template <typename RangeType>
+std::vector<EventChunk> splitRangesIntoChunks(std::stack<RangeType> eventRanges, const size_t events_per_chunk) {
+  std::vector<EventChunk> chunks;
+  while (!eventRanges.empty()) {
+    EventChunk chunk;
+    // Process the event ranges until we reach the desired number of events to read or run out of ranges
+    while (!eventRanges.empty() && chunk.total_events < events_per_chunk) {
+      // Get the next event range from the stack
+      const auto range = eventRanges.top();
+      eventRanges.pop();
+      const auto &eventRange = eventRangeOf(range);
+
+      const size_t range_size = eventRange.second - eventRange.first;
+      const size_t remaining_chunk = events_per_chunk - chunk.total_events;
+
+      // If the range size is larger than the remaining chunk, we need to split it
+      if (range_size > remaining_chunk) {
+        // Split the range: process only part of it now, push the rest back for later
+        addTargetRange(chunk, range, chunk.total_events, remaining_chunk);
+        chunk.offsets.push_back(eventRange.first);
+        chunk.slabsizes.push_back(remaining_chunk);
+        chunk.total_events += remaining_chunk;
+        // Push the remainder of the range back to the front for next iteration
+        eventRanges.push(withEventRange(range, EventROI(eventRange.first + remaining_chunk, eventRange.second)));
+        break;
+      } else if (range_size > 0) {
+        addTargetRange(chunk, range, chunk.total_events, range_size);
+        chunk.offsets.push_back(eventRange.first);
+        chunk.slabsizes.push_back(range_size);
+        chunk.total_events += range_size;
+      }
+    }
+    if (chunk.total_events > 0)
+      chunks.push_back(std::move(chunk));
+  }
+  return chunks;
+}
+} // namespace
+
+/**
+ * Group the event ranges into chunks of at most events_per_chunk events, splitting ranges that cross the end of a
+ * chunk. The chunks are returned in the order they should be read.
+ *
+ * @param eventRanges : ranges of events to read, the top of the stack is read first
+ * @param events_per_chunk : maximum number of events to read from disk at one time
+ */
+std::vector<EventChunk> splitIntoChunks(std::stack<EventROI> eventRanges, const size_t events_per_chunk) {
+  return splitRangesIntoChunks(std::move(eventRanges), events_per_chunk);
+}
+
+/**
+ * Group the event ranges of each target into chunks of at most events_per_chunk events, as for the ranges without
+ * targets. Each chunk also records where the events of each target are within the chunk.
+ *
+ * @param eventSplitRanges : targets and ranges of events to read, the top of the stack is read first
+ * @param events_per_chunk : maximum number of events to read from disk at one time
+ */
+std::vector<EventChunk> splitIntoChunks(std::stack<std::pair<int, EventROI>> eventSplitRanges,
+                                        const size_t events_per_chunk) {
+  return splitRangesIntoChunks(std::move(eventSplitRanges), events_per_chunk);
+}
+
 std::string toLogString(const std::string &bankName, const size_t total_events_to_read,
                         const std::vector<size_t> &offsets, const std::vector<size_t> &slabsizes) {
   std::ostringstream oss;
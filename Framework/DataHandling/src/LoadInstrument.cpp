@@ -12,6 +12,7 @@
 #include "MantidAPI/Progress.h"
 #include "MantidDataHandling/LoadGeometry.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/InstrumentCache.h"
 #include "MantidGeometry/Instrument/InstrumentDefinitionParser.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/ConfigService.h"
@@ -170,10 +171,13 @@ void LoadInstrument::exec() {
   Instrument_sptr instrument;
 
   // Define a parser if using IDFs
+  std::string instrumentXMLText;
   if (loader_type == LoaderType::Xml)
-    parser = InstrumentDefinitionParser(filename, instname, InstrumentXML->value());
+    instrumentXMLText = InstrumentXML->value();
   else if (loader_type == LoaderType::Idf)
-    parser = InstrumentDefinitionParser(filename, instname, Strings::loadFile(filename));
+    instrumentXMLText = Strings::loadFile(filename);
+  if (loader_type < LoaderType::Nxs)
+    parser = InstrumentDefinitionParser(filename, instname, instrumentXMLText);
 
   // Find the mangled instrument name that includes the modified date
   if (loader_type < LoaderType::Nxs)
@@ -183,6 +187,8 @@ void LoadInstrument::exec() {
   else
     throw std::runtime_error("Unknown instrument LoaderType");
 
+  // The binary cache file of a parsed instrument, written once the lock is released
+  std::string instrumentCacheContents;
   {
     // Make InstrumentService access thread-safe
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
@@ -193,12 +199,21 @@ void LoadInstrument::exec() {
       instrument = InstrumentDataService::Instance().retrieve(instrumentNameMangled);
     } else {
       if (loader_type < LoaderType::Nxs) {
-        // Really create the instrument
+        // Really create the instrument, from the binary cache written by an earlier process if there is one
         Progress prog(this, 0.0, 1.0, 100);
         {
           const auto timerStart = std::chrono::high_resolution_clock::now();
-          instrument = parser.parseXML(&prog);
-          addTimer("parseXML", timerStart, std::chrono::high_resolution_clock::now());
+          instrument = InstrumentCache::load(instrumentNameMangled);
+          if (instrument) {
+            instrument->setFilename(filename);
+            instrument->setXmlText(instrumentXMLText);
+            addTimer("loadInstrumentCache", timerStart, std::chrono::high_resolution_clock::now());
+          } else {
+            instrument = parser.parseXML(&prog);
+            addTimer("parseXML", timerStart, std::chrono::high_resolution_clock::now());
+            if (InstrumentCache::isEnabled())
+              instrumentCacheContents = InstrumentCache::encode(*instrument, instrumentNameMangled);
+          }
         }
         {
           // Parse the instrument tree (internally create ComponentInfo and
@@ -239,6 +254,9 @@ void LoadInstrument::exec() {
       runLoadParameterFile(ws, filename);
   } // end of mutex scope
 
+  if (!instrumentCacheContents.empty())
+    InstrumentCache::save(instrumentCacheContents, instrumentNameMangled);
+
   // Set the monitors output property
   setProperty("MonitorList", (ws->getInstrument())->getMonitorIDs());
 
@@ -38,33 +38,128 @@ ProcessBankData::ProcessBankData(DefaultEventLoader &m_loader, const std::string
   }
 }
 
-/*
- * Pre-counting the events per pixel ID allows for allocating the proper amount of memory in each output event vector
- */
-void ProcessBankData::preCountAndReserveMem() {
-  // ---- Pre-counting events per pixel ID ----
-  std::vector<size_t> counts(m_max_detid - m_min_detid + 1, 0);
-  for (size_t i = 0; i < numEvents; i++) {
-    const auto thisId = static_cast<detid_t>((*event_detid)[i]);
-    if (!(thisId < m_min_detid || thisId > m_max_detid)) // or allows for skipping out early
-      counts[thisId - m_min_detid]++;
+namespace {
+/// Whether an event is to be loaded, based on its detector ID and time-of-flight
+struct EventFilter {
+  detid_t minDetid;
+  detid_t maxDetid;
+  bool noTofFiltering;
+  double tofMin;
+  double tofMax;
+
+  bool operator()(const detid_t detId, const double tof) const {
+    // this is fancy for check if value is in range
+    return (detId >= minDetid && detId <= maxDetid) && (noTofFiltering || ((tof - tofMin) * (tof - tofMax) <= 0.));
   }
+};
 
-  // Now we pre-allocate (reserve) the vectors of events in each pixel counted
-  auto &outputWS = m_loader.m_ws;
+/// Accumulate the time-of-flight limits and touched detector IDs for an event that is loaded
+inline void recordEvent(BankEventStatistics &statistics, const size_t detidIndex, const double tof) {
+  // Skip any events that are the cause of bad DAS data (e.g. a negative
+  // number in uint32 -> 2.4 billion * 100 nanosec = 2.4e8 microsec)
+  if (tof < 2e8) {
+    // tof limits from things observed here
+    if (tof > statistics.longestTof) {
+      statistics.longestTof = tof;
+    }
+    if (tof < statistics.shortestTof) {
+      statistics.shortestTof = tof;
+    }
+  } else
+    statistics.badTofs++;
+
+  // Track all the touched wi
+  if (!statistics.usedDetIds[detidIndex])
+    statistics.usedDetIds[detidIndex] = true;
+}
+} // namespace
+
+/**
+ * Fill the event lists in two passes instead of appending each event to its pixel's vector as it is read. The first
+ * pass counts the events that will be loaded for each (period, pixel). Each pixel's event list is then grown once to
+ * hold them, and the second pass writes every event straight into its slot at the end of the list.
+ *
+ * This replaces pre-counting every event in the bank: only the events that pass the filters are counted, and event
+ * lists are never grown one event at a time. Lists grow geometrically when a bank is processed in several chunks, so
+ * appending a chunk does not copy the events of every earlier chunk. Events for a pixel stay in the order they were
+ * read.
+ *
+ * @param pulseIndexer :: which events belong to which pulse
+ * @param eventVectors :: event vector for each [period][detector ID], nullptr if there is no event list
+ * @param createEvent :: creates the event from its index in the arrays, time-of-flight and pulse time
+ * @param statistics :: accumulated summary of the events loaded
+ */
+template <typename EventType, typename EventFactory>
+void ProcessBankData::scatterEvents(const PulseIndexer &pulseIndexer,
+                                    std::vector<std::vector<std::vector<EventType> *>> &eventVectors,
+                                    const EventFactory &createEvent, BankEventStatistics &statistics) {
   const auto *alg = m_loader.alg;
-  const size_t numEventLists = outputWS.getNumberHistograms();
-  for (detid_t pixID = m_min_detid; pixID <= m_max_detid; ++pixID) {
-    const auto pixelIndex = pixID - m_min_detid; // index from zero
-    if (counts[pixelIndex] > 0) {
-      const size_t wi = getWorkspaceIndexFromPixelID(pixID);
-      // Find the workspace index corresponding to that pixel ID
-      // Allocate it
-      if (wi < numEventLists) {
-        outputWS.reserveEventListAt(wi, counts[pixelIndex]);
+  const EventFilter isLoaded{m_min_detid, m_max_detid, !(alg->filter_tof_range), alg->filter_tof_min,
+                             alg->filter_tof_max};
+  const auto numPixels = static_cast<size_t>(m_max_detid - m_min_detid + 1);
+  const auto eventVectorOf = [&](const size_t key) {
+    return eventVectors[key / numPixels][static_cast<size_t>(m_min_detid) + key % numPixels];
+  };
+
+  // ---- first pass: count the events that will be loaded for each (period, pixel)
+  std::vector<size_t> counts(eventVectors.size() * numPixels, 0);
+  for (const auto &pulseIter : pulseIndexer) {
+    const auto periodIndex = static_cast<size_t>(thisBankPulseTimes->periodNumber(pulseIter.pulseIndex) - 1);
+    for (std::size_t eventIndex = pulseIter.eventIndexStart; eventIndex < pulseIter.eventIndexStop; ++eventIndex) {
+      const auto detId = static_cast<detid_t>((*event_detid)[eventIndex]);
+      if (isLoaded(detId, static_cast<double>((*event_time_of_flight)[eventIndex])))
+        ++counts[periodIndex * numPixels + static_cast<size_t>(detId - m_min_detid)];
+    }
+    // check if cancelled after each 100s of pulses (assumes 60Hz)
+    if ((pulseIter.pulseIndex % 6000 == 0) && alg->getCancel())
+      return;
+  }
+
+  // grow each event list once and point a cursor at the first new event
+  std::vector<EventType *> cursors(counts.size(), nullptr);
+  for (size_t key = 0; key < counts.size(); ++key) {
+    if (counts[key] == 0)
+      continue;
+    // NULL eventVector indicates a bad spectrum lookup
+    auto *eventVector = eventVectorOf(key);
+    if (!eventVector) {
+      statistics.discardedEvents += counts[key];
+      continue;
+    }
+    const auto oldSize = eventVector->size();
+    const auto newSize = oldSize + counts[key];
+    eventVector->reserve(newSize);
+    eventVector->resize(newSize);
+    cursors[key] = eventVector->data() + oldSize;
+  }
+
+  // ---- second pass: write each event into its slot in its event list
+  for (const auto &pulseIter : pulseIndexer) {
+    // Save the pulse time at this index for creating those events
+    const auto &pulsetime = thisBankPulseTimes->pulseTime(pulseIter.pulseIndex);
+    const auto periodIndex = static_cast<size_t>(thisBankPulseTimes->periodNumber(pulseIter.pulseIndex) - 1);
+    auto *periodCursors = cursors.data() + periodIndex * numPixels;
+
+    for (std::size_t eventIndex = pulseIter.eventIndexStart; eventIndex < pulseIter.eventIndexStop; ++eventIndex) {
+      const auto detId = static_cast<detid_t>((*event_detid)[eventIndex]);
+      const auto tof = static_cast<double>((*event_time_of_flight)[eventIndex]);
+      if (isLoaded(detId, tof)) {
+        const auto detidIndex = static_cast<size_t>(detId - m_min_detid);
+        auto &cursor = periodCursors[detidIndex];
+        if (cursor)
+          *(cursor++) = createEvent(eventIndex, tof, pulsetime);
+        recordEvent(statistics, detidIndex, tof);
+      }
+    }
+    if ((pulseIter.pulseIndex % 6000 == 0) && alg->getCancel()) {
+      // drop the slots that were never written
+      for (size_t key = 0; key < cursors.size(); ++key) {
+        if (cursors[key]) {
+          auto *eventVector = eventVectorOf(key);
+          eventVector->resize(static_cast<size_t>(cursors[key] - eventVector->data()));
+        }
       }
-      if ((wi % 20 == 0) && alg->getCancel())
-        return; // User cancellation
+      return;
     }
   }
 }
@@ -76,20 +171,12 @@ void ProcessBankData::run() {
   // timer for performance
   Mantid::Kernel::Timer timer;
 
-  // Local tof limits
-  double my_shortest_tof = static_cast<double>(std::numeric_limits<uint32_t>::max()) * 0.1;
-  double my_longest_tof = 0.;
-  // A count of "bad" TOFs that were too high
-  size_t badTofs = 0;
-  size_t my_discarded_events(0);
+  BankEventStatistics statistics;
+  statistics.shortestTof = static_cast<double>(std::numeric_limits<uint32_t>::max()) * 0.1;
+  statistics.longestTof = 0.;
+  statistics.usedDetIds.assign(m_max_detid - m_min_detid + 1, false);
 
   prog->report(entry_name + ": precount");
-  // ---- Pre-counting events per pixel ID ----
-  if (m_loader.precount) {
-    this->preCountAndReserveMem();
-    if (m_loader.alg->getCancel())
-      return; // User cancellation
-  }
 
   // this assumes that pulse indices are sorted
   if (!std::is_sorted(event_index->cbegin(), event_index->cend()))
@@ -103,13 +190,6 @@ void ProcessBankData::run() {
   // Will we need to compress?
   const bool compress = (alg->compressEvents);
 
-  // Which detector IDs were touched?
-  std::vector<bool> usedDetIds(m_max_detid - m_min_detid + 1, false);
-
-  const double TOF_MIN = alg->filter_tof_min;
-  const double TOF_MAX = alg->filter_tof_max;
-  const bool NO_TOF_FILTERING = !(alg->filter_tof_range);
-
   // set up wall-clock filtering if it was requested
   std::vector<size_t> pulseROI;
   if (alg->m_is_time_filtered) {
@@ -123,23 +203,41 @@ void ProcessBankData::run() {
 
   const PulseIndexer pulseIndexer(event_index, startAt, numEvents, entry_name, pulseROI);
 
-  // loop over all pulses
-  for (const auto &pulseIter : pulseIndexer) {
-    // Save the pulse time at this index for creating those events
-    const auto &pulsetime = thisBankPulseTimes->pulseTime(pulseIter.pulseIndex);
-    const int logPeriodNumber = thisBankPulseTimes->periodNumber(pulseIter.pulseIndex);
-    const auto periodIndex = static_cast<size_t>(logPeriodNumber - 1);
+  if (m_loader.precount) {
+    // ---- Counting events per pixel ID then scattering them into place ----
+    if (have_weight) {
+      this->scatterEvents(pulseIndexer, m_loader.weightedEventVectors,
+                          [this](const size_t eventIndex, const double tof, const Types::Core::DateAndTime &pulsetime) {
+                            const auto weight = static_cast<double>((*event_weight)[eventIndex]);
+                            return WeightedEvent(tof, pulsetime, weight, weight * weight);
+                          },
+                          statistics);
+    } else {
+      this->scatterEvents(pulseIndexer, m_loader.eventVectors,
+                          [](const size_t, const double tof, const Types::Core::DateAndTime &pulsetime) {
+                            return Types::Event::TofEvent(tof, pulsetime);
+                          },
+                          statistics);
+    }
+  } else {
+    const EventFilter isLoaded{m_min_detid, m_max_detid, !(alg->filter_tof_range), alg->filter_tof_min,
+                               alg->filter_tof_max};
 
-    // loop through events associated with a single pulse
-    for (std::size_t eventIndex = pulseIter.eventIndexStart; eventIndex < pulseIter.eventIndexStop; ++eventIndex) {
-      // We cached a pointer to the vector<tofEvent> -> so retrieve it and add
-      // the event
-      const detid_t &detId = static_cast<detid_t>((*event_detid)[eventIndex]);
-      if (detId >= m_min_detid && detId <= m_max_detid) {
+    // loop over all pulses
+    for (const auto &pulseIter : pulseIndexer) {
+      // Save the pulse time at this index for creating those events
+      const auto &pulsetime = thisBankPulseTimes->pulseTime(pulseIter.pulseIndex);
+      const int logPeriodNumber = thisBankPulseTimes->periodNumber(pulseIter.pulseIndex);
+      const auto periodIndex = static_cast<size_t>(logPeriodNumber - 1);
+
+      // loop through events associated with a single pulse
+      for (std::size_t eventIndex = pulseIter.eventIndexStart; eventIndex < pulseIter.eventIndexStop; ++eventIndex) {
+        // We cached a pointer to the vector<tofEvent> -> so retrieve it and add
+        // the event
+        const detid_t &detId = static_cast<detid_t>((*event_detid)[eventIndex]);
         // Create the tofevent
         const auto tof = static_cast<double>((*event_time_of_flight)[eventIndex]);
-        // this is fancy for check if value is in range
-        if ((NO_TOF_FILTERING) || ((tof - TOF_MIN) * (tof - TOF_MAX) <= 0.)) {
+        if (isLoaded(detId, tof)) {
           // Handle simulated data if present
           if (have_weight) {
             auto *eventVector = m_loader.weightedEventVectors[periodIndex][detId];
@@ -149,44 +247,29 @@ void ProcessBankData::run() {
               const double errorSq = weight * weight;
               eventVector->emplace_back(tof, pulsetime, weight, errorSq);
             } else {
-              ++my_discarded_events;
+              ++statistics.discardedEvents;
             }
           } else {
             // We have cached the vector of events for this detector ID
             auto *eventVector = m_loader.eventVectors[periodIndex][detId];
             // NULL eventVector indicates a bad spectrum lookup
             if (eventVector) {
-              eventVector->emplace_back(std::move(tof), pulsetime);
+              eventVector->emplace_back(tof, pulsetime);
             } else {
-              ++my_discarded_events;
+              ++statistics.discardedEvents;
             }
           }
 
-          // Skip any events that are the cause of bad DAS data (e.g. a negative
-          // number in uint32 -> 2.4 billion * 100 nanosec = 2.4e8 microsec)
-          if (tof < 2e8) {
-            // tof limits from things observed here
-            if (tof > my_longest_tof) {
-              my_longest_tof = tof;
-            }
-            if (tof < my_shortest_tof) {
-              my_shortest_tof = tof;
-            }
-          } else
-            badTofs++;
-
-          // Track all the touched wi
-          const auto detidIndex = detId - m_min_detid;
-          if (!usedDetIds[detidIndex])
-            usedDetIds[detidIndex] = true;
-        } // valid time-of-flight
-
-      } // valid detector IDs
-    } // for events in pulse
-    // check if cancelled after each 100s of pulses (assumes 60Hz)
-    if ((pulseIter.pulseIndex % 6000 == 0) && alg->getCancel())
-      return;
-  } // for pulses
+          recordEvent(statistics, static_cast<size_t>(detId - m_min_detid), tof);
+        } // valid detector ID and time-of-flight
+      } // for events in pulse
+      // check if cancelled after each 100s of pulses (assumes 60Hz)
+      if ((pulseIter.pulseIndex % 6000 == 0) && alg->getCancel())
+        return;
+    } // for pulses
+  }
+  if (alg->getCancel())
+    return; // User cancellation
 
   // Default pulse time (if none are found)
   const auto pulseSortingType =
@@ -197,7 +280,7 @@ void ProcessBankData::run() {
   auto &outputWS = m_loader.m_ws;
   const size_t numEventLists = outputWS.getNumberHistograms();
   for (detid_t pixID = m_min_detid; pixID <= m_max_detid; ++pixID) {
-    if (usedDetIds[pixID - m_min_detid]) {
+    if (statistics.usedDetIds[pixID - m_min_detid]) {
       // Find the workspace index corresponding to that pixel ID
       size_t wi = getWorkspaceIndexFromPixelID(pixID);
       if (wi < numEventLists) {
@@ -219,14 +302,14 @@ void ProcessBankData::run() {
   // This is not thread safe, so only one thread at a time runs this.
   {
     std::lock_guard<std::mutex> _lock(alg->m_tofMutex);
-    if (my_shortest_tof < alg->shortest_tof) {
-      alg->shortest_tof = my_shortest_tof;
+    if (statistics.shortestTof < alg->shortest_tof) {
+      alg->shortest_tof = statistics.shortestTof;
     }
-    if (my_longest_tof > alg->longest_tof) {
-      alg->longest_tof = my_longest_tof;
+    if (statistics.longestTof > alg->longest_tof) {
+      alg->longest_tof = statistics.longestTof;
     }
-    alg->bad_tofs += badTofs;
-    alg->discarded_events += my_discarded_events;
+    alg->bad_tofs += statistics.badTofs;
+    alg->discarded_events += statistics.discardedEvents;
   }
 
 #ifndef _WIN32
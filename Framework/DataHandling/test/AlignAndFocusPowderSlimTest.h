@@ -23,6 +23,7 @@
 
 #include <gtest/gtest.h>
 #include <numbers>
+#include <numeric>
 
 using Mantid::API::AlgorithmManager;
 using Mantid::API::AnalysisDataService;
@@ -260,6 +261,42 @@ public:
     TS_ASSERT(result);
   }
 
+  void test_read_ahead_chunks() {
+    TestConfig config;
+    config.groupingWS = bank_grouping_ws;
+    auto expectedWS = std::dynamic_pointer_cast<MatrixWorkspace>(run_algorithm(VULCAN_218062, config));
+
+    // load the banks in 9 to 27 chunks so every bank needs more than one chunk read
+    // zero reads each chunk after the previous one is histogrammed
+    for (const int readAheadChunks : {0, 1, 3}) {
+      AlignAndFocusPowderSlim alg;
+      alg.setChild(true);
+      TS_ASSERT_THROWS_NOTHING(alg.initialize())
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("Filename", VULCAN_218062));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "unused"));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("ReadSizeFromDisk", 1000000));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("ReadAheadChunks", readAheadChunks));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("GroupingWorkspace", bank_grouping_ws));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("L1", config.l1));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("L2", config.l2s));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("Polar", config.twoTheta));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("Azimuthal", config.phi));
+      TS_ASSERT_THROWS_NOTHING(alg.execute(););
+      MatrixWorkspace_sptr outputWS = alg.getProperty("OutputWorkspace");
+      TS_ASSERT(outputWS);
+      if (!outputWS)
+        continue;
+
+      TS_ASSERT_EQUALS(outputWS->getNumberHistograms(), expectedWS->getNumberHistograms());
+      for (size_t i = 0; i < expectedWS->getNumberHistograms(); ++i) {
+        const auto &expectedY = expectedWS->readY(i);
+        const auto &y = outputWS->readY(i);
+        TS_ASSERT_EQUALS(std::accumulate(y.begin(), y.end(), 0.),
+                         std::accumulate(expectedY.begin(), expectedY.end(), 0.));
+      }
+    }
+  }
+
   void test_no_grouping() {
     // this should result in 1 spectrum in the output when no grouping is given
     TestConfig config;
@@ -0,0 +1,85 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataHandling/AlignAndFocusPowderSlim/BinFinder.h"
+#include "MantidKernel/VectorHelper.h"
+#include <algorithm>
+#include <cxxtest/TestSuite.h>
+
+using Mantid::DataHandling::AlignAndFocusPowderSlim::BinFinder;
+
+class BinFinderTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BinFinderTest *createSuite() { return new BinFinderTest(); }
+  static void destroySuite(BinFinderTest *suite) { delete suite; }
+
+  void test_linear() {
+    // last bin is narrower than the others
+    const auto binedges = createBinEdges({1000., 10., 20005.});
+    BinFinder finder(&binedges);
+    TS_ASSERT_EQUALS(finder.mode(), BinFinder::Mode::LINEAR);
+    checkAgainstBinarySearch(finder, binedges);
+  }
+
+  void test_logarithmic() {
+    const auto binedges = createBinEdges({1000., -0.001, 20000.});
+    BinFinder finder(&binedges);
+    TS_ASSERT_EQUALS(finder.mode(), BinFinder::Mode::LOGARITHMIC);
+    checkAgainstBinarySearch(finder, binedges);
+  }
+
+  void test_arbitrary() {
+    const std::vector<double> binedges{1000., 1001., 1500., 1502., 1600., 20000.};
+    BinFinder finder(&binedges);
+    TS_ASSERT_EQUALS(finder.mode(), BinFinder::Mode::TABLE);
+    checkAgainstBinarySearch(finder, binedges);
+  }
+
+  void test_few_bins() {
+    const std::vector<double> binedges{1000., 2000., 5000.};
+    BinFinder finder(&binedges);
+    TS_ASSERT_EQUALS(finder.mode(), BinFinder::Mode::TABLE);
+    TS_ASSERT_EQUALS(finder.findBin(1000.), 0);
+    TS_ASSERT_EQUALS(finder.findBin(1999.), 0);
+    TS_ASSERT_EQUALS(finder.findBin(2000.), 1);
+    TS_ASSERT_EQUALS(finder.findBin(4999.), 1);
+  }
+
+  void test_too_few_edges() {
+    const std::vector<double> binedges{1000.};
+    TS_ASSERT_THROWS(BinFinder{&binedges}, const std::runtime_error &);
+  }
+
+private:
+  std::vector<double> createBinEdges(const std::vector<double> &params) {
+    std::vector<double> binedges;
+    Mantid::Kernel::VectorHelper::createAxisFromRebinParams(params, binedges, true, false);
+    return binedges;
+  }
+
+  void checkAgainstBinarySearch(const BinFinder &finder, const std::vector<double> &binedges) {
+    // every bin edge, and values just either side of it, in one block
+    std::vector<double> tofs;
+    for (const auto &edge : binedges) {
+      for (const auto &value : {std::nextafter(edge, 0.), edge, std::nextafter(edge, 1.e9), edge + 0.25})
+        if (value >= binedges.front() && value < binedges.back())
+          tofs.push_back(value);
+    }
+
+    std::vector<size_t> bins(tofs.size());
+    finder.findBins(tofs.data(), bins.data(), tofs.size());
+    for (size_t i = 0; i < tofs.size(); ++i) {
+      const auto it = std::upper_bound(binedges.cbegin(), binedges.cend(), tofs[i]);
+      const auto expected = static_cast<size_t>(std::distance(binedges.cbegin(), it) - 1);
+      TS_ASSERT_EQUALS(bins[i], expected);
+      TS_ASSERT_EQUALS(finder.findBin(tofs[i]), expected);
+    }
+  }
+};
@@ -0,0 +1,74 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataHandling/AlignAndFocusPowderSlim/ProcessBankTaskBase.h"
+#include <cxxtest/TestSuite.h>
+
+using Mantid::DataHandling::AlignAndFocusPowderSlim::EventROI;
+using Mantid::DataHandling::AlignAndFocusPowderSlim::splitIntoChunks;
+
+class ProcessBankTaskBaseTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ProcessBankTaskBaseTest *createSuite() { return new ProcessBankTaskBaseTest(); }
+  static void destroySuite(ProcessBankTaskBaseTest *suite) { delete suite; }
+
+  void test_splitIntoChunks_single_range() {
+    std::stack<EventROI> ranges;
+    ranges.emplace(0, 25);
+
+    const auto chunks = splitIntoChunks(ranges, 10);
+    TS_ASSERT_EQUALS(chunks.size(), 3);
+    TS_ASSERT_EQUALS(chunks[0].offsets, std::vector<size_t>({0}));
+    TS_ASSERT_EQUALS(chunks[0].slabsizes, std::vector<size_t>({10}));
+    TS_ASSERT_EQUALS(chunks[1].offsets, std::vector<size_t>({10}));
+    TS_ASSERT_EQUALS(chunks[1].slabsizes, std::vector<size_t>({10}));
+    TS_ASSERT_EQUALS(chunks[2].offsets, std::vector<size_t>({20}));
+    TS_ASSERT_EQUALS(chunks[2].slabsizes, std::vector<size_t>({5}));
+    TS_ASSERT_EQUALS(chunks[2].total_events, 5);
+  }
+
+  void test_splitIntoChunks_multiple_ranges() {
+    // top of the stack is read first
+    std::stack<EventROI> ranges;
+    ranges.emplace(100, 104);
+    ranges.emplace(50, 50); // empty ranges are skipped
+    ranges.emplace(0, 8);
+
+    const auto chunks = splitIntoChunks(ranges, 10);
+    TS_ASSERT_EQUALS(chunks.size(), 2);
+    TS_ASSERT_EQUALS(chunks[0].offsets, std::vector<size_t>({0, 100}));
+    TS_ASSERT_EQUALS(chunks[0].slabsizes, std::vector<size_t>({8, 2}));
+    TS_ASSERT_EQUALS(chunks[0].total_events, 10);
+    TS_ASSERT_EQUALS(chunks[1].offsets, std::vector<size_t>({102}));
+    TS_ASSERT_EQUALS(chunks[1].slabsizes, std::vector<size_t>({2}));
+    TS_ASSERT_EQUALS(chunks[1].total_events, 2);
+  }
+
+  void test_splitIntoChunks_with_targets() {
+    // top of the stack is read first
+    std::stack<std::pair<int, EventROI>> ranges;
+    ranges.emplace(1, EventROI(20, 26));
+    ranges.emplace(0, EventROI(0, 8));
+
+    const auto chunks = splitIntoChunks(ranges, 10);
+    TS_ASSERT_EQUALS(chunks.size(), 2);
+    TS_ASSERT_EQUALS(chunks[0].offsets, std::vector<size_t>({0, 20}));
+    TS_ASSERT_EQUALS(chunks[0].slabsizes, std::vector<size_t>({8, 2}));
+    TS_ASSERT_EQUALS(chunks[0].relative_target_ranges,
+                     (std::vector<std::pair<int, EventROI>>{{0, EventROI(0, 8)}, {1, EventROI(8, 10)}}));
+    TS_ASSERT_EQUALS(chunks[1].offsets, std::vector<size_t>({22}));
+    TS_ASSERT_EQUALS(chunks[1].slabsizes, std::vector<size_t>({4}));
+    TS_ASSERT_EQUALS(chunks[1].relative_target_ranges, (std::vector<std::pair<int, EventROI>>{{1, EventROI(0, 4)}}));
+  }
+
+  void test_splitIntoChunks_empty() {
+    TS_ASSERT(splitIntoChunks(std::stack<EventROI>(), 10).empty());
+  }
+};
@@ -408,6 +408,9 @@ private:
   template <class T>
   static void histogramForWeightsHelper(const std::vector<T> &events, const double step, const MantidVec &X,
                                         MantidVec &Y, MantidVec &E);
+  template <class T, class Accumulate>
+  static void histogramUnsortedHelper(const std::vector<T> &events, const double step, const MantidVec &X,
+                                      Accumulate &&accumulate);
   template <class T>
   static void integrateHelper(std::vector<T> &events, const double minX, const double maxX, const bool entireRange,
                               double &sum, double &error);
@@ -157,10 +157,14 @@ private:
 
   EventList &getSpectrumWithoutInvalidation(const size_t index) override;
 
+  void initEventLists(const size_t numberOfLists, const EventList &el);
+
   /** A vector that holds the event list for each spectrum; the key is
    * the workspace index, which is not necessarily the pixelid.
+   * The lists are stored contiguously and never reallocated after
+   * initialization, so references to them remain valid.
    */
-  std::vector<std::unique_ptr<EventList>> data;
+  std::vector<EventList> data;
 
   /// Container for the MRU lists of the event lists contained.
   mutable std::unique_ptr<EventWorkspaceMRU> mru;
@@ -235,6 +235,7 @@ private:
   size_t getLinearIndex(size_t *indices) const;
 
   size_t computeSizesFromSplit();
+  void splitChildrenIfNeeded(const bool parallel);
   void fillBoxShell(const size_t tot, const coord_t ChildInverseVolume);
   /**private default copy constructor as the only correct constructor is the one
    * with box controller */
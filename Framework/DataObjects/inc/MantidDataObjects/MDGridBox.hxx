@@ -18,6 +18,8 @@
 #include "MantidKernel/Utils.h"
 #include "MantidKernel/WarningSuppressions.h"
 #include <boost/math/special_functions/round.hpp>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 #include <optional>
 #include <ostream>
 
@@ -104,9 +106,29 @@ TMDE(MDGridBox)::MDGridBox(MDBox<MDE, nd> *box)
   // Prepare to distribute the events that were in the box before, this will
   // load missing events from HDD in file based ws if there are some.
   const std::vector<MDE> &events = box->getConstEvents();
-  // just add event to the existing internal box
-  for (const auto &evnt : events)
-    addEvent(evnt);
+
+  // Find the child of each event once, so that every child can be sized
+  // exactly before the events are copied into it
+  std::vector<size_t> childIndices(events.size());
+  std::vector<size_t> childSizes(numBoxes, 0);
+  for (size_t i = 0; i < events.size(); ++i) {
+    size_t cindex = calculateChildIndex(events[i]);
+    // events on the upper boundary of the last child box belong to it
+    if (cindex == numBoxes)
+      cindex = numBoxes - 1;
+    childIndices[i] = cindex;
+    if (cindex < numBoxes)
+      ++childSizes[cindex];
+  }
+  for (size_t i = 0; i < numBoxes; ++i) {
+    if (childSizes[i] > 0)
+      m_Children[i]->reserveMemoryForLoad(childSizes[i]);
+  }
+  // the children were just created, so nothing else can be adding to them
+  for (size_t i = 0; i < events.size(); ++i) {
+    if (childIndices[i] < numBoxes)
+      m_Children[childIndices[i]]->addEventUnsafe(events[i]);
+  }
 
   // Copy the cached numbers from the incoming box. This is quick - don't need
   // to refresh cache
@@ -700,35 +722,53 @@ TMDE(size_t MDGridBox)::getChildIndexFromID(size_t childId) const {
 /** Goes through all the sub-boxes and splits them if they contain
  * enough events to be worth it.
  *
- * @param ts :: optional ThreadScheduler * that will be used to parallelize
- *        recursive splitting. Set to NULL to do it serially.
+ * In parallel mode the sub-boxes of every grid box are split as
+ * work-stealing TBB tasks, recursively, so that idle threads pick up work
+ * from the large boxes at the top of the tree. The tasks run on no more
+ * threads than the ThreadPool serving the scheduler, so e.g. the NumThreads
+ * of ConvertToMD is respected. All splitting is finished before this
+ * returns and nothing is pushed to the scheduler.
+ *
+ * @param ts :: optional ThreadScheduler *; if set, the recursive splitting
+ *        is done in parallel. Set to NULL to do it serially.
  */
 TMDE(void MDGridBox)::splitAllIfNeeded(Kernel::ThreadScheduler *ts) {
-  for (size_t i = 0; i < numBoxes; ++i) {
+  // zero threads means the scheduler is not served by a pool of known size
+  const size_t numThreads = ts ? ts->numThreads() : 1;
+  if (numThreads == 1) {
+    splitChildrenIfNeeded(false);
+  } else if (numThreads == 0) {
+    splitChildrenIfNeeded(true);
+  } else {
+    tbb::task_arena arena(static_cast<int>(numThreads));
+    arena.execute([this]() { splitChildrenIfNeeded(true); });
+  }
+}
+
+//-----------------------------------------------------------------------------------------------
+/** Splits the sub-boxes that contain enough events to be worth it, and the
+ * sub-boxes of those, recursively.
+ *
+ * @param parallel :: if true, the children are split as TBB tasks in the
+ *        current task arena.
+ */
+TMDE(void MDGridBox)::splitChildrenIfNeeded(const bool parallel) {
+  const auto splitChildIfNeeded = [this, parallel](const size_t i) {
     MDBox<MDE, nd> *box = dynamic_cast<MDBox<MDE, nd> *>(m_Children[i]);
     if (box) {
       // Plain MD-Box. Does it need to be split?
       if (this->m_BoxController->willSplit(box->getNPoints(), box->getDepth())) {
         // The MDBox needs to split into a grid box.
-        if (!ts) {
-          // ------ Perform split serially (no ThreadPool) ------
-          auto gridBox = new MDGridBox<MDE, nd>(box);
-          // Track how many MDBoxes there are in the overall workspace
-          this->m_BoxController->trackNumBoxes(box->getDepth());
-          // Replace in the array
-          m_Children[i] = gridBox;
-          // Delete the old box
-          delete box;
-          // Now recursively check if this NEW grid box's contents should be
-          // split too
-          gridBox->splitAllIfNeeded(nullptr);
-        } else {
-          // ------ Perform split in parallel (using ThreadPool) ------
-          // So we create a task to split this MDBox,
-          // Task is : this->splitContents(i, ts);
-          ts->push(
-              std::make_shared<Kernel::FunctionTask>(std::bind(&MDGridBox<MDE, nd>::splitContents, &*this, i, ts)));
-        }
+        auto gridBox = new MDGridBox<MDE, nd>(box);
+        // Track how many MDBoxes there are in the overall workspace
+        this->m_BoxController->trackNumBoxes(box->getDepth());
+        // Replace in the array
+        m_Children[i] = gridBox;
+        // Delete the old box
+        delete box;
+        // Now recursively check if this NEW grid box's contents should be
+        // split too
+        gridBox->splitChildrenIfNeeded(parallel);
       } else {
         // This box does NOT have enough events to be worth splitting, if it do
         // have at least something in memory then,
@@ -746,18 +786,19 @@ TMDE(void MDGridBox)::splitAllIfNeeded(Kernel::ThreadScheduler *ts) {
       if (gridBox) {
         // Now recursively check if this old grid box's contents should be split
         // too
-        if (!ts || (this->nPoints < this->m_BoxController->getAddingEvents_eventsPerTask()))
-          // Go serially if there are only a few points contained (less
-          // overhead).
-          gridBox->splitAllIfNeeded(ts);
-        else
-          // Go parallel if this is a big enough gridbox.
-          // Task is : gridBox->splitAllIfNeeded(ts);
-          ts->push(
-              std::make_shared<Kernel::FunctionTask>(std::bind(&MDGridBox<MDE, nd>::splitAllIfNeeded, &*gridBox, ts)));
+        gridBox->splitChildrenIfNeeded(parallel);
       }
     }
-  }
+  };
+
+  // Each task only replaces its own child, so the children can be split
+  // independently. The cached nPoints may be stale while events are being
+  // added, so leave it to TBB to balance the small boxes against the large.
+  if (parallel)
+    tbb::parallel_for(size_t(0), numBoxes, splitChildIfNeeded);
+  else
+    for (size_t i = 0; i < numBoxes; ++i)
+      splitChildIfNeeded(i);
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -20,6 +20,7 @@
 namespace Mantid {
 
 namespace Geometry {
+class DetectorBoundingVolumeHierarchy;
 class InstrumentRayTracer;
 }
 
@@ -92,6 +93,9 @@ public:
 
   bool findDetector();
   bool findDetector(const Geometry::InstrumentRayTracer &tracer);
+  bool findDetector(const Geometry::DetectorBoundingVolumeHierarchy &hierarchy);
+  static std::vector<bool> findDetectors(const std::vector<Peak *> &peaks,
+                                         const Geometry::DetectorBoundingVolumeHierarchy &hierarchy);
 
   Mantid::Kernel::V3D getQLabFrame() const override;
   Mantid::Kernel::V3D getQSampleFrame() const override;
@@ -133,6 +137,11 @@ public:
 
 private:
   bool findDetector(const Mantid::Kernel::V3D &beam, const Geometry::InstrumentRayTracer &tracer);
+  static std::optional<int> hitDetectorID(const Geometry::DetectorBoundingVolumeHierarchy &hierarchy,
+                                          const Mantid::Kernel::V3D &direction);
+  template <typename TraceDetectorID>
+  std::optional<int> findDetectorIDAcrossTubeGap(const Mantid::Kernel::V3D &beam,
+                                                 const TraceDetectorID &traceDetectorID) const;
 
   /// Shared pointer to the instrument (for calculating some values )
   Geometry::Instrument_const_sptr m_inst;
@@ -76,7 +76,8 @@ private:
                      const bool tofCorrect, const double factor, const double shift) const;
   template <typename EventType>
   void splitEventVec(const std::function<const DateAndTime(const EventType &)> &timeCalc,
-                     const std::vector<EventType> &events, std::map<int, EventList *> &partials) const;
+                     const std::vector<EventType> &events, std::map<int, EventList *> &partials,
+                     const bool timesAreSorted) const;
 
   void resetCache();
   void resetCachedPartialTimeROIs() const;
@@ -13,17 +13,22 @@
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/TimeROI.h"
 #include "MantidKernel/Unit.h"
+#include "MantidKernel/VectorHelper.h"
 
 #ifdef _MSC_VER
 // qualifier applied to function type has no meaning; ignored
 #pragma warning(disable : 4180)
 #endif
+#include "tbb/parallel_for.h"
 #include "tbb/parallel_sort.h"
+#include "tbb/task_arena.h"
 #ifdef _MSC_VER
 #pragma warning(default : 4180)
 #endif
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cfloat>
 #include <cmath>
 #include <functional>
@@ -48,6 +53,21 @@ constexpr double SEC_TO_NANO{1.e9};
 // this is 4x what parallel_sort uses in the indidividual blocks
 constexpr size_t MIN_VEC_LENGTH_PARALLEL_SORT{2000};
 
+// minimum event vector length to use a radix sort when sorting by a key
+constexpr size_t MIN_VEC_LENGTH_RADIX_SORT{8192};
+
+// minimum event vector length to split each radix sort pass across threads
+constexpr size_t MIN_VEC_LENGTH_PARALLEL_RADIX_SORT{1 << 18};
+
+// maximum event vector length to use a radix sort, which needs a copy of the events and their keys. Longer lists
+// use the in-place tbb::parallel_sort so that sorting does not double the memory they take
+constexpr size_t MAX_VEC_LENGTH_RADIX_SORT{1 << 20};
+
+// number of bits of the key sorted in each radix sort pass
+constexpr unsigned int RADIX_BITS{8};
+constexpr size_t RADIX_BUCKETS{size_t{1} << RADIX_BITS};
+constexpr uint64_t SIGN_BIT{uint64_t{1} << 63};
+
 /**
  * Calculate the corrected full time in nanoseconds
  * @param event : The event with pulse time and time-of-flight
@@ -142,9 +162,10 @@ struct comparePulseTimeTOFDelta {
 struct FindBin {
   double divisor;
   double offset;
+  bool logBinning;
   std::optional<size_t> (*findBin)(const Mantid::MantidVec &, const double, const double, const double, const bool);
-  FindBin(double step, double xmin) {
-    if (step < 0) {
+  FindBin(double step, double xmin) : logBinning(step < 0) {
+    if (logBinning) {
       findBin = Mantid::DataObjects::EventList::findLogBin;
       divisor = 1. / log1p(abs(step)); // use this to do change of base
       offset = log(xmin) * divisor;
@@ -160,6 +181,33 @@ struct FindBin {
   }
 };
 
+namespace {
+/// Number of events whose time-of-flight is staged into a contiguous column by the unsorted binning kernel
+constexpr size_t TOF_COLUMN_BLOCK_SIZE{1024};
+
+/**
+ * Estimate the bin number of each time-of-flight in a contiguous column. This is the closed-form part of
+ * EventList::findLinearBin/findLogBin written as a unit-stride loop without calls through a function pointer,
+ * so that the compiler can vectorize it.
+ *
+ * @param tofs :: contiguous column of time-of-flight values
+ * @param estimates :: output column of (unrounded) bin numbers
+ * @param count :: number of values in the columns
+ * @param findBin :: pre-calculated divisor/offset of the binning
+ */
+void estimateBins(const double *tofs, double *estimates, const size_t count, const FindBin &findBin) {
+  const double divisor = findBin.divisor;
+  const double offset = findBin.offset;
+  if (findBin.logBinning) {
+    for (size_t i = 0; i < count; ++i)
+      estimates[i] = std::log(tofs[i]) * divisor - offset;
+  } else {
+    for (size_t i = 0; i < count; ++i)
+      estimates[i] = tofs[i] * divisor - offset;
+  }
+}
+} // namespace
+
 /// Constructor (empty)
 // EventWorkspace is always histogram data and so is thus EventList
 EventList::EventList(const EventType event_type)
@@ -1079,16 +1127,6 @@ void EventList::setSortOrder(const EventSortType order) const { this->order = or
 
 namespace {
 // these are abstractions
-template <class RandomIt> void switchable_sort(RandomIt first, RandomIt last) {
-  const auto vec_size = static_cast<size_t>(std::distance(first, last));
-  if (vec_size < 2)
-    return;
-  else if (vec_size < MIN_VEC_LENGTH_PARALLEL_SORT)
-    std::sort(first, last);
-  else
-    tbb::parallel_sort(first, last);
-}
-
 template <class RandomIt, class Compare> void switchable_sort(RandomIt first, RandomIt last, Compare comp) {
   const auto vec_size = static_cast<size_t>(std::distance(first, last));
   if (vec_size < 2)
@@ -1098,6 +1136,117 @@ template <class RandomIt, class Compare> void switchable_sort(RandomIt first, Ra
   else
     tbb::parallel_sort(first, last, comp);
 }
+
+/// Radix sort key that orders the same as a time-of-flight, made from the bit pattern of the double
+inline uint64_t tofKey(const double tof) {
+  const auto bits = std::bit_cast<uint64_t>(tof);
+  return (bits & SIGN_BIT) ? ~bits : (bits | SIGN_BIT);
+}
+
+/// Radix sort key that orders the same as a signed integer, e.g. a time in nanoseconds
+inline uint64_t int64Key(const int64_t value) { return static_cast<uint64_t>(value) ^ SIGN_BIT; }
+
+template <typename Func> void forEachBlock(const size_t numBlocks, const Func &func) {
+  if (numBlocks == 1)
+    func(0);
+  else
+    tbb::parallel_for(size_t{0}, numBlocks, func);
+}
+
+/**
+ * Stable least-significant-digit radix sort of events by a key of one or more 64-bit words, least significant word
+ * first, one byte per pass. The keys are worked out once and moved with the events. Passes where every event has the
+ * same digit are skipped, which is most of them for real data. Long lists are split into blocks that are counted and
+ * scattered in parallel. Each block writes to its own range of every bucket, so the sort remains stable.
+ * @param events :: the events to sort
+ * @param key :: returns the key of an event as an array of words
+ */
+template <size_t NumWords, typename EventType, typename KeyFunc>
+void radixSort(std::vector<EventType> &events, const KeyFunc &key) {
+  using Key = std::array<uint64_t, NumWords>;
+  const size_t numEvents = events.size();
+  const size_t numBlocks =
+      numEvents < MIN_VEC_LENGTH_PARALLEL_RADIX_SORT ? 1 : static_cast<size_t>(tbb::this_task_arena::max_concurrency());
+  const size_t blockSize = (numEvents + numBlocks - 1) / numBlocks;
+
+  std::vector<Key> keys(numEvents);
+  forEachBlock(numBlocks, [&](const size_t block) {
+    const auto stop = std::min(numEvents, (block + 1) * blockSize);
+    for (size_t i = block * blockSize; i < stop; ++i)
+      keys[i] = key(events[i]);
+  });
+
+  std::vector<EventType> scratch(numEvents);
+  std::vector<Key> scratchKeys(numEvents);
+  std::vector<std::array<size_t, RADIX_BUCKETS>> offsets(numBlocks);
+  for (size_t word = 0; word < NumWords; ++word) {
+    for (unsigned int shift = 0; shift < 64; shift += RADIX_BITS) {
+      const auto digit = [&keys, word, shift](const size_t i) {
+        return static_cast<size_t>((keys[i][word] >> shift) & (RADIX_BUCKETS - 1));
+      };
+
+      // count the digits in each block
+      forEachBlock(numBlocks, [&](const size_t block) {
+        auto &counts = offsets[block];
+        counts.fill(0);
+        const auto stop = std::min(numEvents, (block + 1) * blockSize);
+        for (size_t i = block * blockSize; i < stop; ++i)
+          ++counts[digit(i)];
+      });
+
+      // convert the counts into where each block starts writing each bucket
+      size_t position = 0;
+      bool allSameDigit = false;
+      for (size_t bucket = 0; bucket < RADIX_BUCKETS && !allSameDigit; ++bucket) {
+        const auto bucketStart = position;
+        for (auto &blockOffsets : offsets) {
+          const auto count = blockOffsets[bucket];
+          blockOffsets[bucket] = position;
+          position += count;
+        }
+        allSameDigit = (position - bucketStart == numEvents);
+      }
+      if (allSameDigit)
+        continue;
+
+      forEachBlock(numBlocks, [&](const size_t block) {
+        auto &destinations = offsets[block];
+        const auto stop = std::min(numEvents, (block + 1) * blockSize);
+        for (size_t i = block * blockSize; i < stop; ++i) {
+          const auto destination = destinations[digit(i)]++;
+          scratch[destination] = events[i];
+          scratchKeys[destination] = keys[i];
+        }
+      });
+      events.swap(scratch);
+      keys.swap(scratchKeys);
+    }
+  }
+}
+
+/// Whether a list is sorted with a radix sort rather than the equivalent comparison sort
+inline bool useRadixSort(const size_t numEvents) {
+  return numEvents >= MIN_VEC_LENGTH_RADIX_SORT && numEvents <= MAX_VEC_LENGTH_RADIX_SORT;
+}
+
+/// Sort by a key using a radix sort for long lists, otherwise using the equivalent comparison
+template <typename EventType, typename Compare, typename KeyFunc>
+void keyed_sort(std::vector<EventType> &events, Compare comp, const KeyFunc &key) {
+  if (useRadixSort(events.size()))
+    radixSort<1>(events, [&key](const EventType &event) { return std::array<uint64_t, 1>{key(event)}; });
+  else
+    switchable_sort(events.begin(), events.end(), std::move(comp));
+}
+
+/// Sort by pulse time then time-of-flight, as one radix sort with the pulse time as the most significant word
+template <typename EventType> void keyed_sort_pulsetime_tof(std::vector<EventType> &events) {
+  if (useRadixSort(events.size()))
+    radixSort<2>(events, [](const EventType &event) {
+      return std::array<uint64_t, 2>{tofKey(event.tof()), int64Key(event.pulseTime().totalNanoseconds())};
+    });
+  else
+    switchable_sort(events.begin(), events.end(), compareEventPulseTimeTOF);
+}
 } // anonymous namespace
 
 // --------------------------------------------------------------------------
@@ -1113,15 +1262,17 @@ void EventList::sortTof() const {
   if (this->order == TOF_SORT) // cppcheck-suppress identicalConditionAfterEarlyExit
     return;
 
+  const auto byTof = [](const auto &left, const auto &right) { return left < right; };
+  const auto tofOf = [](const auto &event) { return tofKey(event.tof()); };
   switch (eventType) {
   case TOF:
-    switchable_sort(events->begin(), events->end());
+    keyed_sort(*events, byTof, tofOf);
     break;
   case WEIGHTED:
-    switchable_sort(weightedEvents->begin(), weightedEvents->end());
+    keyed_sort(*weightedEvents, byTof, tofOf);
     break;
   case WEIGHTED_NOTIME:
-    switchable_sort(weightedEventsNoTime->begin(), weightedEventsNoTime->end());
+    keyed_sort(*weightedEventsNoTime, byTof, tofOf);
     break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1149,18 +1300,21 @@ void EventList::sortTimeAtSample(const double &tofFactor, const double &tofShift
     return;
 
   // Perform sort.
+  const auto timeAtSampleOf = [tofFactor, tofShift](const auto &event) {
+    return int64Key(calculateCorrectedFullTime(event, tofFactor, tofShift));
+  };
   switch (eventType) {
   case TOF: {
     CompareTimeAtSample<TofEvent> comparitor(tofFactor, tofShift);
-    switchable_sort(events->begin(), events->end(), comparitor);
+    keyed_sort(*events, comparitor, timeAtSampleOf);
   } break;
   case WEIGHTED: {
     CompareTimeAtSample<WeightedEvent> comparitor(tofFactor, tofShift);
-    switchable_sort(weightedEvents->begin(), weightedEvents->end(), comparitor);
+    keyed_sort(*weightedEvents, comparitor, timeAtSampleOf);
   } break;
   case WEIGHTED_NOTIME: {
     CompareTimeAtSample<WeightedEventNoTime> comparitor(tofFactor, tofShift);
-    switchable_sort(weightedEventsNoTime->begin(), weightedEventsNoTime->end(), comparitor);
+    keyed_sort(*weightedEventsNoTime, comparitor, timeAtSampleOf);
   } break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1180,12 +1334,13 @@ void EventList::sortPulseTime() const {
     return;
 
   // Perform sort.
+  const auto pulseTimeOf = [](const auto &event) { return int64Key(event.pulseTime().totalNanoseconds()); };
   switch (eventType) {
   case TOF:
-    switchable_sort(events->begin(), events->end(), compareEventPulseTime);
+    keyed_sort(*events, compareEventPulseTime, pulseTimeOf);
     break;
   case WEIGHTED:
-    switchable_sort(weightedEvents->begin(), weightedEvents->end(), compareEventPulseTime);
+    keyed_sort(*weightedEvents, compareEventPulseTime, pulseTimeOf);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1211,10 +1366,10 @@ void EventList::sortPulseTimeTOF() const {
 
   switch (eventType) {
   case TOF:
-    switchable_sort(events->begin(), events->end(), compareEventPulseTimeTOF);
+    keyed_sort_pulsetime_tof(*events);
     break;
   case WEIGHTED:
-    switchable_sort(weightedEvents->begin(), weightedEvents->end(), compareEventPulseTimeTOF);
+    keyed_sort_pulsetime_tof(*weightedEvents);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -2051,15 +2206,10 @@ typename std::vector<T>::const_iterator static findFirstEvent(const std::vector<
 template <class T>
 typename std::vector<T>::const_iterator EventList::findFirstPulseEvent(const std::vector<T> &events,
                                                                        const double seek_pulsetime) {
-  auto itev = events.cbegin();
-  auto itev_end = events.cend(); // cache for speed
-
-  // if tof < X[0], that means that you need to skip some events
-  while ((itev != itev_end) && (static_cast<double>(itev->pulseTime().totalNanoseconds()) < seek_pulsetime))
-    itev++;
-  // Better fix would be to use a binary search instead of the linear one used
-  // here.
-  return itev;
+  // the events are sorted by pulse time, so skip the ones before seek_pulsetime with a search
+  return Kernel::VectorHelper::gallopPartitionPoint(events.cbegin(), events.cend(), [seek_pulsetime](const T &event) {
+    return static_cast<double>(event.pulseTime().totalNanoseconds()) < seek_pulsetime;
+  });
 }
 
 // --------------------------------------------------------------------------
@@ -2235,23 +2385,10 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events, const do
   if (events.empty())
     return;
 
-  const auto xmin = X.front();
-  const auto xmax = X.back();
-
-  auto findBin = FindBin(step, xmin);
-
-  for (const T &ev : events) {
-    const double tof = ev.tof();
-    if (tof < xmin || tof >= xmax)
-      continue;
-
-    std::optional<size_t> n_bin = findBin(X, tof, true);
-
-    if (n_bin) {
-      Y[n_bin.value()] += ev.weight();
-      E[n_bin.value()] += ev.errorSquared();
-    }
-  }
+  histogramUnsortedHelper(events, step, X, [&Y, &E](const size_t bin, const T &ev) {
+    Y[bin] += ev.weight();
+    E[bin] += ev.errorSquared();
+  });
 
   // Now do the sqrt of all errors
   std::transform(E.cbegin(), E.cend(), E.begin(), static_cast<double (*)(double)>(sqrt));
@@ -2713,20 +2850,50 @@ void EventList::generateCountsHistogram(const double step, const MantidVec &X, M
   if (this->events->empty())
     return;
 
+  histogramUnsortedHelper(*this->events, step, X, [&Y](const size_t bin, const TofEvent &) { Y[bin]++; });
+}
+
+// --------------------------------------------------------------------------
+/** Bin unsorted events with linear or logarithmic binning.
+ *
+ * The events are stored as an array of structures, but binning only needs the time-of-flight. The events are
+ * therefore processed in blocks: the time-of-flight of each block is staged into a contiguous column, the bin
+ * numbers are estimated for the whole column in one vectorizable pass, and only then are the estimates corrected
+ * to the exact bin and accumulated. This gives the same result as calling findLinearBin/findLogBin per event.
+ *
+ * @param events :: vector of events to bin
+ * @param step :: bin step size, negative for logarithmic binning
+ * @param X :: The x bins
+ * @param accumulate :: callable taking the bin number and the event to add to it
+ */
+template <class T, class Accumulate>
+void EventList::histogramUnsortedHelper(const std::vector<T> &events, const double step, const MantidVec &X,
+                                        Accumulate &&accumulate) {
   const auto xmin = X.front();
   const auto xmax = X.back();
-
-  auto findBin = FindBin(step, xmin);
-
-  for (const TofEvent &ev : *this->events) {
-    const double tof = ev.tof();
-    if (tof < xmin || tof >= xmax)
-      continue;
-
-    const std::optional<size_t> n_bin = findBin(X, tof, true);
-
-    if (n_bin)
-      Y[n_bin.value()]++;
+  const auto findBin = FindBin(step, xmin);
+  const auto numBoundaries = static_cast<double>(X.size());
+
+  std::array<double, TOF_COLUMN_BLOCK_SIZE> tofs;
+  std::array<double, TOF_COLUMN_BLOCK_SIZE> estimates;
+
+  for (size_t blockStart = 0; blockStart < events.size(); blockStart += TOF_COLUMN_BLOCK_SIZE) {
+    const size_t count = std::min(TOF_COLUMN_BLOCK_SIZE, events.size() - blockStart);
+    const T *block = events.data() + blockStart;
+
+    for (size_t i = 0; i < count; ++i)
+      tofs[i] = block[i].tof();
+    estimateBins(tofs.data(), estimates.data(), count, findBin);
+
+    for (size_t i = 0; i < count; ++i) {
+      const double tof = tofs[i];
+      if (tof < xmin || tof >= xmax)
+        continue;
+      // same range check as findLinearBin/findLogBin, done before the cast to avoid overflow
+      if (!(estimates[i] > -1. && estimates[i] < numBoundaries))
+        continue;
+      accumulate(findExactBin(X, tof, static_cast<size_t>(estimates[i])), block[i]);
+    }
   }
 }
 
@@ -4214,9 +4381,21 @@ void EventList::filterByPulseTime(Kernel::TimeROI const *timeRoi, EventList *out
   }
 }
 
+namespace {
+/** Return the first event at or after the given iterator with a pulse time that is not
+ * before the given time. The events must be sorted by pulse time.
+ * @param first :: where to start looking
+ * @param last :: end of the events
+ * @param time :: pulse time to find
+ */
+template <typename Iterator> Iterator firstEventAtPulseTime(Iterator first, Iterator last, const DateAndTime &time) {
+  return Kernel::VectorHelper::gallopPartitionPoint(first, last,
+                                                    [&time](const auto &event) { return event.pulseTime() < time; });
+}
+} // namespace
+
 /** Filter a vector of events into another based on pulse time.
- * TODO: Make this more efficient using STL-fu.
- * @param events :: input events
+ * @param events :: input events, sorted by pulse time
  * @param start :: start time (absolute)
  * @param stop :: end time (absolute)
  * @param output :: reference to an event list that will be output.
@@ -4224,13 +4403,13 @@ void EventList::filterByPulseTime(Kernel::TimeROI const *timeRoi, EventList *out
 template <class T>
 void EventList::filterByPulseTimeHelper(std::vector<T> &events, DateAndTime start, DateAndTime stop,
                                         std::vector<T> &output) {
-  std::copy_if(events.begin(), events.end(), std::back_inserter(output),
-               [start, stop](const T &t) { return (t.m_pulsetime >= start) && (t.m_pulsetime < stop); });
+  const auto first = firstEventAtPulseTime(events.cbegin(), events.cend(), start);
+  const auto last = firstEventAtPulseTime(first, events.cend(), stop);
+  output.insert(output.end(), first, last);
 }
 
 /** Filter a vector of events into another based on TimeROI.
- * TODO: Make this more efficient using STL-fu.
- * @param events :: input events
+ * @param events :: input events, sorted by pulse time
  * @param intervals :: Interval vec of start and stop times
  * @param output :: reference to an event list that will be output.
  */
@@ -4240,26 +4419,19 @@ void EventList::filterByTimeROIHelper(std::vector<T> &events, const std::vector<
   // Iterate through the splitter at the same time
   auto itspl = intervals.cbegin();
   auto itspl_end = intervals.cend();
-  // Iterate through all events (sorted by tof)
+  // Iterate through all events (sorted by pulse time)
   auto itev = events.cbegin();
   auto itev_end = events.cend();
 
   // This is the time of the first section. Anything before is thrown out.
   while (itspl != itspl_end) {
-    // Get the splitting interval times and destination
-    DateAndTime start = itspl->start();
-    DateAndTime stop = itspl->stop();
     // Skip the events before the start of the time
-    while ((itev != itev_end) && (itev->m_pulsetime < start))
-      itev++;
-
-    // Go through all the events that are in the interval (if any)
-    while ((itev != itev_end) && (itev->m_pulsetime < stop)) {
-      // Copy the event into another
-      const T eventCopy(*itev);
-      output->addEventQuickly(eventCopy);
-      ++itev;
-    }
+    itev = firstEventAtPulseTime(itev, itev_end, itspl->start());
+
+    // Copy all the events that are in the interval (if any)
+    const auto itstop = firstEventAtPulseTime(itev, itev_end, itspl->stop());
+    for (; itev != itstop; ++itev)
+      output->addEventQuickly(*itev);
 
     // Go to the next interval
     ++itspl;
@@ -4336,7 +4508,6 @@ void EventList::filterInPlaceHelper(Kernel::TimeROI const *timeRoi, typename std
   // Iterate through the splitter at the same time
   auto itspl = splitter.cbegin();
   auto itspl_end = splitter.cend();
-  DateAndTime start, stop;
 
   // Iterate for the input
   auto itev = events.begin();
@@ -4348,27 +4519,20 @@ void EventList::filterInPlaceHelper(Kernel::TimeROI const *timeRoi, typename std
 
   // This is the time of the first section. Anything before is thrown out.
   while (itspl != itspl_end) {
-    // Get the splitting interval times and destination
-    start = itspl->start();
-    stop = itspl->stop();
     // Skip the events before the start of the time
-    while ((itev != itev_end) && (itev->m_pulsetime < start))
-      itev++;
+    itev = firstEventAtPulseTime(itev, itev_end, itspl->start());
+    // The events that are in the interval (if any)
+    const auto itstop = firstEventAtPulseTime(itev, itev_end, itspl->stop());
 
     // Are we aligned in the input vs output?
     bool copyingInPlace = (itOut == itev);
     if (copyingInPlace) {
-      while ((itev != itev_end) && (itev->m_pulsetime < stop))
-        ++itev;
+      itev = itstop;
       // Make sure the iterators still match
       itOut = itev;
     } else {
-      // Go through all the events that are in the interval (if any)
-      while ((itev != itev_end) && (itev->m_pulsetime < stop)) {
-        *itOut = *itev;
-        ++itOut;
-        ++itev;
-      }
+      itOut = std::copy(itev, itstop, itOut);
+      itev = itstop;
     }
 
     // Go to the next interval
@@ -47,14 +47,17 @@ using namespace Mantid::Kernel;
 EventWorkspace::EventWorkspace() : IEventWorkspace(), mru(std::make_unique<EventWorkspaceMRU>()) {}
 
 EventWorkspace::EventWorkspace(const EventWorkspace &other)
-    : IEventWorkspace(other), mru(std::make_unique<EventWorkspaceMRU>()) {
-  for (const auto &el : other.data) {
-    // Create a new event list, copying over the events
-    auto newel = std::make_unique<EventList>(*el);
-    // Make sure to update the MRU to point to THIS event workspace.
-    newel->setMRU(this->mru.get());
-    this->data.emplace_back(std::move(newel));
-  }
+    : IEventWorkspace(other), data(other.data.size()), mru(std::make_unique<EventWorkspaceMRU>()) {
+  // The event lists are allocated as one block above, so only the events themselves are copied here. Each copy
+  // allocates exactly the size of the source list, which is independent of the others and done in parallel.
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, data.size()),
+                    [this, &other](const tbb::blocked_range<size_t> &range) {
+                      for (size_t i = range.begin(); i < range.end(); ++i) {
+                        data[i] = other.data[i];
+                        // Make sure to update the MRU to point to THIS event workspace.
+                        data[i].setMRU(this->mru.get());
+                      }
+                    });
 }
 
 EventWorkspace::~EventWorkspace() { data.clear(); }
@@ -92,15 +95,10 @@ void EventWorkspace::init(const std::size_t &NVectors, const std::size_t &XLengt
   HistogramData::BinEdges edges{0.0, std::numeric_limits<double>::min()};
 
   // Initialize the data
-  data.resize(NVectors);
   // Make sure SOMETHING exists for all initialized spots.
   EventList el;
   el.setHistogram(edges);
-  for (size_t i = 0; i < NVectors; i++) {
-    data[i] = std::make_unique<EventList>(el);
-    data[i]->setMRU(mru.get());
-    data[i]->setSpectrumNo(specnum_t(i));
-  }
+  initEventLists(NVectors, el);
 
   // Create axes.
   m_axes.resize(2);
@@ -115,20 +113,31 @@ void EventWorkspace::init(const HistogramData::Histogram &histogram) {
   if (histogram.sharedY() || histogram.sharedE())
     throw std::runtime_error("EventWorkspace cannot be initialized non-NULL Y or E data");
 
-  data.resize(numberOfDetectorGroups());
   EventList el;
   el.setHistogram(histogram);
-  for (size_t i = 0; i < data.size(); i++) {
-    data[i] = std::make_unique<EventList>(el);
-    data[i]->setMRU(mru.get());
-    data[i]->setSpectrumNo(specnum_t(i));
-  }
+  initEventLists(numberOfDetectorGroups(), el);
 
   m_axes.resize(2);
   m_axes[0] = std::make_unique<API::RefAxis>(this);
   m_axes[1] = std::make_unique<API::SpectraAxis>(this);
 }
 
+/** Replace the event lists with copies of a template list. The lists are held in a single contiguous allocation
+ * rather than one heap allocation per spectrum, which keeps creation, cloning and deletion of workspaces with many
+ * spectra fast.
+ * @param numberOfLists :: The number of event lists
+ * @param el :: The event list to copy into each spectrum
+ */
+void EventWorkspace::initEventLists(const size_t numberOfLists, const EventList &el) {
+  data.clear();
+  data.reserve(numberOfLists);
+  for (size_t i = 0; i < numberOfLists; i++) {
+    auto &newel = data.emplace_back(el);
+    newel.setMRU(mru.get());
+    newel.setSpectrumNo(specnum_t(i));
+  }
+}
+
 ///  Returns true if the workspace is ragged (has differently sized spectra).
 /// @returns true if the workspace is ragged.
 bool EventWorkspace::isRaggedWorkspace() const {
@@ -136,9 +145,9 @@ bool EventWorkspace::isRaggedWorkspace() const {
     throw std::runtime_error("There are no pixels in the event workspace, "
                              "therefore cannot determine if it is ragged.");
   } else {
-    const auto numberOfBins = data[0]->histogram_size();
+    const auto numberOfBins = data[0].histogram_size();
     return std::any_of(data.cbegin(), data.cend(),
-                       [&numberOfBins](const auto &eventList) { return numberOfBins != eventList->histogram_size(); });
+                       [&numberOfBins](const auto &eventList) { return numberOfBins != eventList.histogram_size(); });
   }
 }
 
@@ -147,7 +156,7 @@ bool EventWorkspace::isRaggedWorkspace() const {
 size_t EventWorkspace::size() const {
   return std::accumulate(
       data.begin(), data.end(), static_cast<size_t>(0),
-      [](size_t value, const std::unique_ptr<EventList> &histo) { return value + histo->histogram_size(); });
+      [](size_t value, const EventList &histo) { return value + histo.histogram_size(); });
 }
 
 /// Get the blocksize, aka the number of bins in the histogram
@@ -157,9 +166,9 @@ size_t EventWorkspace::blocksize() const {
     throw std::range_error("EventWorkspace::blocksize, no pixels in workspace, "
                            "therefore cannot determine blocksize (# of bins).");
   } else {
-    size_t numBins = data[0]->histogram_size();
+    size_t numBins = data[0].histogram_size();
     const auto iterPos = std::find_if_not(data.cbegin(), data.cend(),
-                                          [numBins](const auto &iter) { return numBins == iter->histogram_size(); });
+                                          [numBins](const auto &iter) { return numBins == iter.histogram_size(); });
     if (iterPos != data.cend())
       throw std::length_error("blocksize undefined because size of histograms is not equal");
     return numBins;
@@ -172,7 +181,7 @@ size_t EventWorkspace::blocksize() const {
  */
 std::size_t EventWorkspace::getNumberBins(const std::size_t &index) const {
   if (index < data.size())
-    return data[index]->histogram_size();
+    return data[index].histogram_size();
 
   throw std::invalid_argument("Could not find number of bins in a histogram at index " + std::to_string(index) +
                               ": index is too large.");
@@ -185,9 +194,9 @@ std::size_t EventWorkspace::getMaxNumberBins() const {
   if (data.empty()) {
     return 0;
   } else {
-    auto maxNumberOfBins = data[0]->histogram_size();
+    auto maxNumberOfBins = data[0].histogram_size();
     for (const auto &iter : data) {
-      const auto numberOfBins = iter->histogram_size();
+      const auto numberOfBins = iter.histogram_size();
       if (numberOfBins > maxNumberOfBins)
         maxNumberOfBins = numberOfBins;
     }
@@ -212,7 +221,7 @@ EventList &EventWorkspace::getSpectrumWithoutInvalidation(const size_t index) {
 const EventList &EventWorkspace::getSpectrum(const size_t index) const {
   if (index >= data.size())
     throw std::range_error("EventWorkspace::getSpectrum, workspace index out of range");
-  return *data[index];
+  return data[index];
 }
 
 /**
@@ -226,7 +235,7 @@ const EventList &EventWorkspace::getSpectrum(const size_t index) const {
  * @param index Workspace index
  * @return Pointer to EventList
  */
-EventList *EventWorkspace::getSpectrumUnsafe(const size_t index) { return data[index].get(); }
+EventList *EventWorkspace::getSpectrumUnsafe(const size_t index) { return &data[index]; }
 
 double EventWorkspace::getTofMin() const { return this->getEventXMin(); }
 
@@ -436,7 +445,7 @@ void EventWorkspace::getEventXMinMax(double &xmin, double &xmax) const {
 /// @returns The total number of events
 size_t EventWorkspace::getNumberEvents() const {
   return std::accumulate(data.cbegin(), data.cend(), size_t{0},
-                         [](const auto total, const auto &list) { return total + list->getNumberEvents(); });
+                         [](const auto total, const auto &list) { return total + list.getNumberEvents(); });
 }
 
 /** Get the EventType of the most-specialized EventList in the workspace
@@ -446,7 +455,7 @@ size_t EventWorkspace::getNumberEvents() const {
 Mantid::API::EventType EventWorkspace::getEventType() const {
   Mantid::API::EventType out = Mantid::API::TOF;
   for (const auto &list : this->data) {
-    Mantid::API::EventType thisType = list->getEventType();
+    Mantid::API::EventType thisType = list.getEventType();
     if (static_cast<int>(out) < static_cast<int>(thisType)) {
       out = thisType;
       // This is the most-specialized it can get.
@@ -463,7 +472,7 @@ Mantid::API::EventType EventWorkspace::getEventType() const {
  */
 void EventWorkspace::switchEventType(const Mantid::API::EventType type) {
   for (auto &eventList : this->data)
-    eventList->switchTo(type);
+    eventList.switchTo(type);
 }
 
 /// Returns true always - an EventWorkspace always represents histogramm-able
@@ -486,7 +495,7 @@ size_t EventWorkspace::getMemorySize() const {
 
   // Add the memory from all the event lists
   size_t total = std::accumulate(data.begin(), data.end(), size_t{0},
-                                 [](size_t total, auto &list) { return total + list->getMemorySize(); });
+                                 [](size_t total, auto &list) { return total + list.getMemorySize(); });
 
   total += run().getMemorySize();
 
@@ -567,7 +576,7 @@ void EventWorkspace::generateHistogram(const std::size_t index, const MantidVec
                                        bool skipError) const {
   if (index >= data.size())
     throw std::range_error("EventWorkspace::generateHistogram, histogram number out of range");
-  this->data[index]->generateHistogram(X, Y, E, skipError);
+  this->data[index].generateHistogram(X, Y, E, skipError);
 }
 
 /** Using the event data in the event list, generate a histogram of it w.r.t
@@ -585,7 +594,7 @@ void EventWorkspace::generateHistogramPulseTime(const std::size_t index, const M
   if (index >= data.size())
     throw std::range_error("EventWorkspace::generateHistogramPulseTime, "
                            "histogram number out of range");
-  this->data[index]->generateHistogramPulseTime(X, Y, E, skipError);
+  this->data[index].generateHistogramPulseTime(X, Y, E, skipError);
 }
 
 /** Set all histogram X vectors.
@@ -597,7 +606,7 @@ void EventWorkspace::setAllX(const HistogramData::BinEdges &x) {
   // just reset the whole Histogram.
   invalidateCommonBinsFlag();
   for (auto &eventList : this->data)
-    eventList->setHistogram(x);
+    eventList.setHistogram(x);
 
   // Clear MRU lists now, free up memory
   this->clearMRU();
@@ -660,9 +669,9 @@ private:
  */
 EventSortType EventWorkspace::getSortType() const {
   size_t dataSize = this->data.size();
-  EventSortType order = data[0]->getSortType();
+  EventSortType order = data[0].getSortType();
   for (size_t i = 1; i < dataSize; i++) {
-    if (order != data[i]->getSortType())
+    if (order != data[i].getSortType())
       return UNSORTED;
   }
   return order;
@@ -709,7 +718,7 @@ void EventWorkspace::getIntegratedSpectra(std::vector<double> &out, const double
   PARALLEL_FOR_NO_WSP_CHECK()
   for (int wksp_index = 0; wksp_index < int(this->getNumberHistograms()); wksp_index++) {
     // Get Handle to data
-    EventList const *el = this->data[wksp_index].get();
+    EventList const *el = &this->data[wksp_index];
 
     // Let the eventList do the integration
     out[wksp_index] = el->integrate(minX, maxX, entireRange);
@@ -13,10 +13,12 @@
 #include "MantidGeometry/MDGeometry/MDDimensionExtents.h"
 #include "MantidGeometry/MDGeometry/MDGeometryXMLBuilder.h"
 #include "MantidGeometry/MDGeometry/MDHistoDimension.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Utils.h"
 #include "MantidKernel/VMD.h"
 #include "MantidKernel/WarningSuppressions.h"
 
+#include <algorithm>
 #include <boost/scoped_array.hpp>
 #include <cmath>
 #include <map>
@@ -28,6 +30,30 @@ using namespace Mantid::Geometry;
 using namespace Mantid::API;
 
 namespace Mantid::DataObjects {
+
+namespace {
+/// Number of bins handed to a thread at a time by the element-wise operations
+constexpr size_t BINS_PER_CHUNK{16384};
+
+/** Apply an element-wise operation to every bin. The bins are split into
+ * contiguous chunks that are processed in parallel; within a chunk the loop is
+ * simple enough for the compiler to vectorize.
+ *
+ * @param length :: the number of bins
+ * @param operation :: called with the index of each bin
+ */
+template <typename Operation> void forEachBin(const size_t length, const Operation &operation) {
+  const auto numChunks = static_cast<int64_t>((length + BINS_PER_CHUNK - 1) / BINS_PER_CHUNK);
+  PARALLEL_FOR_IF(numChunks > 1)
+  for (int64_t chunk = 0; chunk < numChunks; ++chunk) {
+    const size_t begin = static_cast<size_t>(chunk) * BINS_PER_CHUNK;
+    const size_t end = std::min(begin + BINS_PER_CHUNK, length);
+    for (size_t i = begin; i < end; ++i)
+      operation(i);
+  }
+}
+} // namespace
+
 //----------------------------------------------------------------------------------------------
 /** Constructor given the 4 dimensions
  * @param dimX :: X dimension binning parameters
@@ -701,11 +727,11 @@ MDHistoWorkspace &MDHistoWorkspace::operator+=(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::add(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "add");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     m_signals[i] += b.m_signals[i];
     m_errorsSquared[i] += b.m_errorsSquared[i];
     m_numEvents[i] += b.m_numEvents[i];
-  }
+  });
   m_nEventsContributed += b.m_nEventsContributed;
 }
 
@@ -717,10 +743,10 @@ void MDHistoWorkspace::add(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::add(const signal_t signal, const signal_t error) {
   signal_t errorSquared = error * error;
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     m_signals[i] += signal;
     m_errorsSquared[i] += errorSquared;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -740,11 +766,11 @@ MDHistoWorkspace &MDHistoWorkspace::operator-=(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::subtract(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "subtract");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     m_signals[i] -= b.m_signals[i];
     m_errorsSquared[i] += b.m_errorsSquared[i];
     m_numEvents[i] += b.m_numEvents[i];
-  }
+  });
   m_nEventsContributed += b.m_nEventsContributed;
 }
 
@@ -756,10 +782,10 @@ void MDHistoWorkspace::subtract(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::subtract(const signal_t signal, const signal_t error) {
   signal_t errorSquared = error * error;
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     m_signals[i] -= signal;
     m_errorsSquared[i] += errorSquared;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -788,7 +814,7 @@ MDHistoWorkspace &MDHistoWorkspace::operator*=(const MDHistoWorkspace &b_ws) {
  * */
 void MDHistoWorkspace::multiply(const MDHistoWorkspace &b_ws) {
   checkWorkspaceSize(b_ws, "multiply");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -800,7 +826,7 @@ void MDHistoWorkspace::multiply(const MDHistoWorkspace &b_ws) {
 
     m_signals[i] = f;
     m_errorsSquared[i] = df2;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -819,7 +845,7 @@ void MDHistoWorkspace::multiply(const signal_t signal, const signal_t error) {
   signal_t b = signal;
   signal_t db2 = error * error;
 
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -828,7 +854,7 @@ void MDHistoWorkspace::multiply(const signal_t signal, const signal_t error) {
 
     m_signals[i] = f;
     m_errorsSquared[i] = df2;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -857,7 +883,7 @@ MDHistoWorkspace &MDHistoWorkspace::operator/=(const MDHistoWorkspace &b_ws) {
  **/
 void MDHistoWorkspace::divide(const MDHistoWorkspace &b_ws) {
   checkWorkspaceSize(b_ws, "divide");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -869,7 +895,7 @@ void MDHistoWorkspace::divide(const MDHistoWorkspace &b_ws) {
 
     m_signals[i] = f;
     m_errorsSquared[i] = df2;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -888,7 +914,7 @@ void MDHistoWorkspace::divide(const signal_t signal, const signal_t error) {
   signal_t b = signal;
   signal_t db2 = error * error;
   signal_t db2_relative = db2 / (b * b);
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -897,7 +923,7 @@ void MDHistoWorkspace::divide(const signal_t signal, const signal_t error) {
 
     m_signals[i] = f;
     m_errorsSquared[i] = df2;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -907,7 +933,7 @@ void MDHistoWorkspace::divide(const signal_t signal, const signal_t error) {
  * \f$ df^2 = a^2 / da^2 \f$
  */
 void MDHistoWorkspace::log(double filler) {
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
     if (a <= 0) {
@@ -917,7 +943,7 @@ void MDHistoWorkspace::log(double filler) {
       m_signals[i] = std::log(a);
       m_errorsSquared[i] = da2 / (a * a);
     }
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -927,7 +953,7 @@ void MDHistoWorkspace::log(double filler) {
  * \f$ df^2 = (ln(10)^-2) * a^2 / da^2 \f$
  */
 void MDHistoWorkspace::log10(double filler) {
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
     if (a <= 0) {
@@ -937,7 +963,7 @@ void MDHistoWorkspace::log10(double filler) {
       m_signals[i] = std::log10(a);
       m_errorsSquared[i] = 0.1886117 * da2 / (a * a); // 0.1886117  = ln(10)^-2
     }
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -947,12 +973,12 @@ void MDHistoWorkspace::log10(double filler) {
  * \f$ df^2 = f^2 * da^2 \f$
  */
 void MDHistoWorkspace::exp() {
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     signal_t f = std::exp(m_signals[i]);
     signal_t da2 = m_errorsSquared[i];
     m_signals[i] = f;
     m_errorsSquared[i] = f * f * da2;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -964,13 +990,13 @@ void MDHistoWorkspace::exp() {
  */
 void MDHistoWorkspace::power(double exponent) {
   double exponent_squared = exponent * exponent;
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     signal_t a = m_signals[i];
     signal_t f = std::pow(a, exponent);
     signal_t da2 = m_errorsSquared[i];
     m_signals[i] = f;
     m_errorsSquared[i] = f * f * exponent_squared * da2 / (a * a);
-  }
+  });
 }
 
 //==============================================================================================
@@ -989,10 +1015,10 @@ void MDHistoWorkspace::power(double exponent) {
  * @return *this after operation */
 MDHistoWorkspace &MDHistoWorkspace::operator&=(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "&= (and)");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     m_signals[i] = ((m_signals[i] != 0 && !m_masks[i]) && (b.m_signals[i] != 0 && !b.m_masks[i])) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
   return *this;
 }
 /// @endcond DOXYGEN_BUG
@@ -1006,10 +1032,10 @@ MDHistoWorkspace &MDHistoWorkspace::operator&=(const MDHistoWorkspace &b) {
  * @return *this after operation */
 MDHistoWorkspace &MDHistoWorkspace::operator|=(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "|= (or)");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     m_signals[i] = ((m_signals[i] != 0 && !m_masks[i]) || (b.m_signals[i] != 0 && !b.m_masks[i])) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
   return *this;
 }
 
@@ -1023,10 +1049,10 @@ MDHistoWorkspace &MDHistoWorkspace::operator|=(const MDHistoWorkspace &b) {
  * @return *this after operation */
 MDHistoWorkspace &MDHistoWorkspace::operator^=(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "^= (xor)");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     m_signals[i] = ((m_signals[i] != 0 && !m_masks[i]) ^ (b.m_signals[i] != 0 && !b.m_masks[i])) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
   return *this;
 }
 
@@ -1037,10 +1063,10 @@ MDHistoWorkspace &MDHistoWorkspace::operator^=(const MDHistoWorkspace &b) {
  * 0.0 is "false", all other values are "true". All errors are set to 0.
  */
 void MDHistoWorkspace::operatorNot() {
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     m_signals[i] = (m_signals[i] == 0.0 || m_masks[i]) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0.0;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1053,10 +1079,10 @@ void MDHistoWorkspace::operatorNot() {
  */
 void MDHistoWorkspace::lessThan(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "lessThan");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     m_signals[i] = (m_signals[i] < b.m_signals[i]) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0.0;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1068,10 +1094,10 @@ void MDHistoWorkspace::lessThan(const MDHistoWorkspace &b) {
  * @param signal :: signal value on the RHS of the comparison.
  */
 void MDHistoWorkspace::lessThan(const signal_t signal) {
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     m_signals[i] = (m_signals[i] < signal) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0.0;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1084,10 +1110,10 @@ void MDHistoWorkspace::lessThan(const signal_t signal) {
  */
 void MDHistoWorkspace::greaterThan(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "greaterThan");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     m_signals[i] = (m_signals[i] > b.m_signals[i]) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1099,10 +1125,10 @@ void MDHistoWorkspace::greaterThan(const MDHistoWorkspace &b) {
  * @param signal :: signal value on the RHS of the comparison.
  */
 void MDHistoWorkspace::greaterThan(const signal_t signal) {
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     m_signals[i] = (m_signals[i] > signal) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1116,11 +1142,11 @@ void MDHistoWorkspace::greaterThan(const signal_t signal) {
  */
 void MDHistoWorkspace::equalTo(const MDHistoWorkspace &b, const signal_t tolerance) {
   checkWorkspaceSize(b, "equalTo");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     signal_t diff = fabs(m_signals[i] - b.m_signals[i]);
     m_signals[i] = (diff < tolerance) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1133,11 +1159,11 @@ void MDHistoWorkspace::equalTo(const MDHistoWorkspace &b, const signal_t toleran
  * @param tolerance :: accept this deviation from a perfect equality
  */
 void MDHistoWorkspace::equalTo(const signal_t signal, const signal_t tolerance) {
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     signal_t diff = fabs(m_signals[i] - signal);
     m_signals[i] = (diff < tolerance) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1159,12 +1185,12 @@ void MDHistoWorkspace::equalTo(const signal_t signal, const signal_t tolerance)
 void MDHistoWorkspace::setUsingMask(const MDHistoWorkspace &mask, const MDHistoWorkspace &values) {
   checkWorkspaceSize(mask, "setUsingMask");
   checkWorkspaceSize(values, "setUsingMask");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     if (mask.m_signals[i] != 0.0) {
       m_signals[i] = values.m_signals[i];
       m_errorsSquared[i] = values.m_errorsSquared[i];
     }
-  }
+  });
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1187,12 +1213,12 @@ void MDHistoWorkspace::setUsingMask(const MDHistoWorkspace &mask, const MDHistoW
 void MDHistoWorkspace::setUsingMask(const MDHistoWorkspace &mask, const signal_t signal, const signal_t error) {
   signal_t errorSquared = error * error;
   checkWorkspaceSize(mask, "setUsingMask");
-  for (size_t i = 0; i < m_length; ++i) {
+  forEachBin(m_length, [&](const size_t i) {
     if (mask.m_signals[i] != 0.0) {
       m_signals[i] = signal;
       m_errorsSquared[i] = errorSquared;
     }
-  }
+  });
 }
 
 /**
@@ -6,6 +6,8 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataObjects/Peak.h"
 #include "MantidDataObjects/NoShape.h"
+#include "MantidGeometry/Instrument/DetectorBoundingVolumeHierarchy.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
 #include "MantidGeometry/Instrument/ReferenceFrame.h"
 #include "MantidGeometry/Objects/InstrumentRayTracer.h"
@@ -648,53 +650,116 @@ bool Peak::findDetector(const InstrumentRayTracer &tracer) {
  * @return True if a detector has been found
  */
 bool Peak::findDetector(const Mantid::Kernel::V3D &beam, const InstrumentRayTracer &tracer) {
-  bool found = false;
-  // Create a ray tracer
-  tracer.traceFromSample(beam);
-  IDetector_const_sptr det = tracer.getDetectorResult();
-  if (det) {
-    // Set the detector ID, the row, col, etc.
-    this->setDetectorID(det->getID());
-    // The old detector position is not more precise if it comes from
-    // FindPeaksMD
-    detPos = det->getPos();
-    found = true;
+  const auto traceDetectorID = [&tracer](const V3D &direction) -> std::optional<int> {
+    tracer.traceFromSample(direction);
+    IDetector_const_sptr det = tracer.getDetectorResult();
+    if (!det)
+      return std::nullopt;
+    return static_cast<int>(det->getID());
+  };
+  auto detectorID = traceDetectorID(beam);
+  if (!detectorID)
+    detectorID = findDetectorIDAcrossTubeGap(beam, traceDetectorID);
+  if (!detectorID)
+    return false;
+  // Set the detector ID, the row, col, etc. and the position of the detector
+  this->setDetectorID(detectorID.value());
+  return true;
+}
+
+/**
+ * Performs the same algorithm as findDetector() but traces the ray through a
+ * DetectorBoundingVolumeHierarchy built once for the instrument, which is much
+ * faster if findDetector is to be called many times over the same instrument.
+ * @param hierarchy A hierarchy over the detectors of this peak's instrument.
+ * @return true if the detector ID was found.
+ */
+bool Peak::findDetector(const DetectorBoundingVolumeHierarchy &hierarchy) {
+  return findDetectors({this}, hierarchy).front();
+}
+
+/**
+ * Find the detector of each of a set of peaks as findDetector() does, tracing
+ * the rays of all the peaks through the hierarchy in parallel in one batch.
+ * @param peaks The peaks, all on the instrument the hierarchy was built for.
+ * @param hierarchy A hierarchy over the detectors of the instrument.
+ * @return whether the detector of each peak was found.
+ */
+std::vector<bool> Peak::findDetectors(const std::vector<Peak *> &peaks,
+                                      const DetectorBoundingVolumeHierarchy &hierarchy) {
+  std::vector<V3D> beams;
+  beams.reserve(peaks.size());
+  std::transform(peaks.cbegin(), peaks.cend(), std::back_inserter(beams),
+                 [](const Peak *peak) { return normalize(peak->detPos - peak->m_samplePos); });
+  const auto hits = hierarchy.findDetectors(hierarchy.detectorInfo().samplePosition(), beams);
+
+  const auto &detectorIDs = hierarchy.detectorInfo().detectorIDs();
+  const auto traceDetectorID = [&hierarchy](const V3D &direction) { return hitDetectorID(hierarchy, direction); };
+  std::vector<bool> found(peaks.size(), false);
+  for (size_t i = 0; i < peaks.size(); ++i) {
+    std::optional<int> detectorID;
+    if (hits[i])
+      detectorID = static_cast<int>(detectorIDs[hits[i].value()]);
+    else
+      detectorID = peaks[i]->findDetectorIDAcrossTubeGap(beams[i], traceDetectorID);
+    if (detectorID) {
+      peaks[i]->setDetectorID(detectorID.value());
+      found[i] = true;
+    }
   }
-  // Use tube-gap parameter in instrument parameter file  to find peaks with
-  // center in gaps between tubes
-  else if (m_inst->hasParameter("tube-gap")) {
-    std::vector<double> gaps = m_inst->getNumberParameter("tube-gap", true);
-    if (!gaps.empty()) {
-      const auto gap = static_cast<double>(gaps.front());
-      // try adding and subtracting tube-gap in 3 q dimensions to see if you can
-      // find detectors on each side of tube gap
-      for (int i = 0; i < 3; i++) {
-        V3D gapDir;
-        gapDir[i] = gap;
-        V3D beam1 = beam + gapDir;
-        tracer.traceFromSample(normalize(beam1));
-        IDetector_const_sptr det1 = tracer.getDetectorResult();
-        V3D beam2 = beam - gapDir;
-        tracer.traceFromSample(normalize(beam2));
-        IDetector_const_sptr det2 = tracer.getDetectorResult();
-        if (det1 && det2) {
-          // compute the cosAngle to select the detector closes to beam
-          if (beam1.cosAngle(beam) > beam2.cosAngle(beam)) {
-            // det1 is closer, use det1
-            this->setDetectorID(static_cast<int>(det1->getID()));
-            detPos = det1->getPos();
-          } else {
-            // det2 is closer, let's use det2
-            this->setDetectorID(static_cast<int>(det2->getID()));
-            detPos = det2->getPos();
-          }
-          found = true;
-          break;
-        }
+  return found;
+}
+
+/**
+ * The ID of the detector hit by a ray from the sample through a hierarchy
+ * @param hierarchy : Hierarchy over the detectors of the instrument
+ * @param direction : Direction of the ray from the sample
+ * @return The ID of the detector hit, if any
+ */
+std::optional<int> Peak::hitDetectorID(const DetectorBoundingVolumeHierarchy &hierarchy, const V3D &direction) {
+  const auto &detectorInfo = hierarchy.detectorInfo();
+  const auto index = hierarchy.findDetector(detectorInfo.samplePosition(), direction);
+  if (!index)
+    return std::nullopt;
+  return static_cast<int>(detectorInfo.detectorIDs()[index.value()]);
+}
+
+/**
+ * Use tube-gap parameter in instrument parameter file to find peaks with
+ * center in gaps between tubes, by trying on each side of the gap
+ * @param beam : Detector direction from the sample as V3D, which hits no detector
+ * @param traceDetectorID : Returns the ID of the detector along a direction, if any
+ * @return The ID of the detector closest to the beam either side of the gap, if any
+ */
+template <typename TraceDetectorID>
+std::optional<int> Peak::findDetectorIDAcrossTubeGap(const V3D &beam, const TraceDetectorID &traceDetectorID) const {
+  if (!m_inst->hasParameter("tube-gap"))
+    return std::nullopt;
+  std::vector<double> gaps = m_inst->getNumberParameter("tube-gap", true);
+  if (gaps.empty())
+    return std::nullopt;
+  const auto gap = static_cast<double>(gaps.front());
+  // try adding and subtracting tube-gap in 3 q dimensions to see if you can
+  // find detectors on each side of tube gap
+  for (int i = 0; i < 3; i++) {
+    V3D gapDir;
+    gapDir[i] = gap;
+    V3D beam1 = beam + gapDir;
+    const auto det1 = traceDetectorID(normalize(beam1));
+    V3D beam2 = beam - gapDir;
+    const auto det2 = traceDetectorID(normalize(beam2));
+    if (det1 && det2) {
+      // compute the cosAngle to select the detector closes to beam
+      if (beam1.cosAngle(beam) > beam2.cosAngle(beam)) {
+        // det1 is closer, use det1
+        return det1;
+      } else {
+        // det2 is closer, let's use det2
+        return det2;
       }
     }
   }
-  return found;
+  return std::nullopt;
 }
 
 //----------------------------------------------------------------------------------------------
@@ -10,6 +10,7 @@
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/SplittingInterval.h"
 #include "MantidKernel/TimeROI.h"
+#include "MantidKernel/VectorHelper.h"
 
 namespace Mantid {
 using API::EventType;
@@ -591,13 +592,25 @@ void TimeSplitter::splitEventVec(const std::vector<EventType> &events, std::map<
     timeCalc = [](const EventType &event) { return event.pulseTime(); };
   }
 
-  // do the actual event splitting
-  this->splitEventVec(timeCalc, events, partials);
+  // do the actual event splitting. Only the pulse times are guaranteed to be in order, since events sorted by pulse
+  // time then TOF can have later pulse+TOF times than events from the next pulse
+  this->splitEventVec(timeCalc, events, partials, !pulseTof);
 }
 
+/**
+ * Distribute a list of events by comparing the times calculated by timeCalc against the splitter boundaries.
+ *
+ * @tparam EventType : one of EventType::TOF or EventType::WEIGHTED
+ * @param timeCalc : calculates the time of an event
+ * @param events : list of input events
+ * @param partials : target list of partial event lists associated with different destination indexes
+ * @param timesAreSorted : if true, the calculated times are known to be in order, so the end of the events within
+ * each splitter is found with a search rather than by testing every event
+ */
 template <typename EventType>
 void TimeSplitter::splitEventVec(const std::function<const DateAndTime(const EventType &)> &timeCalc,
-                                 const std::vector<EventType> &events, std::map<int, EventList *> &partials) const {
+                                 const std::vector<EventType> &events, std::map<int, EventList *> &partials,
+                                 const bool timesAreSorted) const {
   // get a reference of the splitters as a vector
   const auto &splittersVec = getSplittingIntervals(true);
 
@@ -609,18 +622,26 @@ void TimeSplitter::splitEventVec(const std::function<const DateAndTime(const Eve
   auto itEvent = events.cbegin();
   const auto itEventEnd = events.cend();
 
-  // copy all events before first splitter to NO_TARGET
-  auto partial = partials.find(TimeSplitter::NO_TARGET);
-  {
-    const auto stop = itSplitter->start();
-    const bool shouldAppend = (partial != partials.end());
-    while (itEvent != itEventEnd && timeCalc(*itEvent) < stop) {
-      if (shouldAppend)
+  // find the first event at or after itEvent with a time that is not before stop
+  const auto findStopEvent = [&timeCalc, &itEventEnd, timesAreSorted](const auto first, const DateAndTime &stop) {
+    const auto isBefore = [&timeCalc, &stop](const EventType &event) { return timeCalc(event) < stop; };
+    if (timesAreSorted)
+      return Kernel::VectorHelper::gallopPartitionPoint(first, itEventEnd, isBefore);
+    return std::find_if_not(first, itEventEnd, isBefore);
+  };
+
+  // copy the events up to itStop to the partial, if there is one
+  const auto appendEvents = [&itEvent, &partials](const auto itStop, const int destination) {
+    const auto partial = partials.find(destination);
+    if (partial != partials.end()) {
+      for (; itEvent != itStop; ++itEvent)
         partial->second->addEventQuickly(*itEvent); // emplaces a copy of *itEvent in partial
-      // advance event iterator
-      itEvent++;
     }
-  }
+    itEvent = itStop;
+  };
+
+  // copy all events before first splitter to NO_TARGET
+  appendEvents(findStopEvent(itEvent, itSplitter->start()), TimeSplitter::NO_TARGET);
 
   // iterate over all events. For each event try finding its destination event list, a.k.a. partial.
   // If the partial is found, append the event to it. It is assumed events are sorted by (possibly corrected) time
@@ -647,35 +668,16 @@ void TimeSplitter::splitEventVec(const std::function<const DateAndTime(const Eve
     if (itSplitter == itSplitterEnd)
       break;
 
-    // determine the new stop time and destination
-    const int destination = itSplitter->index();
-    const auto stop = itSplitter->stop();
-
-    // find the new partial to add to
-    partial = partials.find(destination);
-
-    // loop over events up to the end of the roi
-    const bool shouldAppend = (partial != partials.end());
-    while (itEvent != itEventEnd && timeCalc(*itEvent) < stop) {
-      if (shouldAppend)
-        partial->second->addEventQuickly(*itEvent); // emplaces a copy of *itEvent in partial
-      // advance event iterator
-      itEvent++;
-    }
+    // copy the events up to the end of the roi to the partial of its destination
+    appendEvents(findStopEvent(itEvent, itSplitter->stop()), itSplitter->index());
 
     // increment to the next interval
     itSplitter++;
   }
 
   // copy all events after last splitter to NO_TARGET
-  if (itEvent != itEventEnd) {
-    partial = partials.find(TimeSplitter::NO_TARGET);
-    if (partial != partials.end()) {
-      for (; itEvent != itEventEnd; ++itEvent) {
-        partial->second->addEventQuickly(*itEvent); // emplaces a copy of *itEvent in partial
-      }
-    }
-  }
+  if (itEvent != itEventEnd)
+    appendEvents(itEventEnd, TimeSplitter::NO_TARGET);
 }
 
 /**
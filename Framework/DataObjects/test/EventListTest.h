@@ -21,6 +21,7 @@
 
 #include <boost/scoped_ptr.hpp>
 #include <cmath>
+#include <numeric>
 
 using namespace Mantid;
 using namespace Mantid::API;
@@ -842,6 +843,61 @@ public:
     }
   }
 
+  /// Lists this long are radix sorted
+  void test_sort_long_lists_all_types() {
+    constexpr size_t NUM_EVENTS{20000};
+    for (int this_type = 0; this_type < 3; this_type++) {
+      for (const auto sortType : {TOF_SORT, PULSETIME_SORT, PULSETIMETOF_SORT}) {
+        EventList list;
+        // a few pulses and times-of-flight, including negative ones, so that there are ties
+        for (size_t i = 0; i < NUM_EVENTS; i++) {
+          const auto pulseTime = static_cast<int64_t>((i * 104729) % 50) - 20;
+          list += TofEvent(static_cast<double>((i * 7919) % 1000) - 100.5, pulseTime);
+        }
+        list.switchTo(static_cast<EventType>(this_type));
+        const auto unsortedTofs = list.getTofs();
+        const double tofSum = std::accumulate(unsortedTofs.cbegin(), unsortedTofs.cend(), 0.);
+
+        list.sort(sortType);
+        TS_ASSERT_EQUALS(list.getSortType(), sortType);
+        TS_ASSERT_EQUALS(list.getNumberEvents(), NUM_EVENTS);
+        const auto tofs = list.getTofs();
+        TS_ASSERT_EQUALS(std::accumulate(tofs.cbegin(), tofs.cend(), 0.), tofSum);
+        for (size_t i = 1; i < NUM_EVENTS; i++) {
+          const auto previous = list.getEvent(i - 1);
+          const auto current = list.getEvent(i);
+          if (sortType == TOF_SORT) {
+            TSM_ASSERT_LESS_THAN_EQUALS(this_type, previous.tof(), current.tof());
+          } else if (this_type != WEIGHTED_NOTIME) {
+            TSM_ASSERT_LESS_THAN_EQUALS(this_type, previous.pulseTime(), current.pulseTime());
+            if (sortType == PULSETIMETOF_SORT && previous.pulseTime() == current.pulseTime()) {
+              TSM_ASSERT_LESS_THAN_EQUALS(this_type, previous.tof(), current.tof());
+            }
+          }
+        }
+      }
+    }
+  }
+
+  void test_sortTimeAtSample_long_list() {
+    constexpr size_t NUM_EVENTS{20000};
+    const double tofFactor = 0.5;
+    const double tofShift = 1.e-6;
+    EventList list;
+    for (size_t i = 0; i < NUM_EVENTS; i++)
+      list += TofEvent(static_cast<double>((i * 7919) % 10000), static_cast<int64_t>((i * 104729) % 5000) * 1000);
+    list.sortTimeAtSample(tofFactor, tofShift);
+
+    const auto timeAtSample = [&](const TofEvent &event) {
+      return event.pulseTime().totalNanoseconds() +
+             static_cast<int64_t>(tofFactor * (event.tof() * 1.0E3) + tofShift * 1.0E9);
+    };
+    const auto &events = list.getEvents();
+    for (size_t i = 1; i < NUM_EVENTS; i++) {
+      TS_ASSERT_LESS_THAN_EQUALS(timeAtSample(events[i - 1]), timeAtSample(events[i]));
+    }
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_reverse_allTypes() {
     // Go through each possible EventType as the input
@@ -1892,6 +1948,28 @@ public:
     do_testSplit_FilterInPlace_Everything(true);
   }
 
+  void test_filterInPlace_many_intervals() {
+    this->fake_uniform_time_data();
+    EventList copy(el);
+
+    // keep 3 out of every 10 pulses
+    Kernel::TimeROI timeRoi;
+    for (int time = 5; time < 1000; time += 10)
+      timeRoi.addROI(time, time + 3);
+
+    EventList filtered;
+    el.filterByPulseTime(&timeRoi, &filtered);
+    copy.filterInPlace(&timeRoi);
+
+    TS_ASSERT_EQUALS(copy.getNumberEvents(), 300);
+    TS_ASSERT_EQUALS(filtered.getNumberEvents(), 300);
+    for (std::size_t i = 0; i < copy.getNumberEvents(); i++) {
+      const auto pulseTime = copy.getEvent(i).pulseTime().totalNanoseconds();
+      TS_ASSERT_EQUALS(pulseTime, filtered.getEvent(i).pulseTime().totalNanoseconds());
+      TS_ASSERT_EQUALS(pulseTime % 10 - 5, static_cast<int64_t>(i % 3));
+    }
+  }
+
   void test_filterInPlace_notime_throws() {
     this->fake_uniform_time_data();
     el.switchTo(WEIGHTED_NOTIME);
@@ -2872,6 +2950,19 @@ public:
     run_generateHistogramUnsortedTest(e, {1.05, -0.002, 1.1}, 45.);
   }
 
+  void test_generateHistogramUnsorted_spans_several_blocks() {
+    // more events than are staged in one block by the unsorted binning kernel
+    EventList e;
+    for (int i = 0; i < 5000; i++)
+      e += TofEvent((i * 7919) % 5000 * 0.02 + 0.01);
+    run_generateHistogramUnsortedTest(e, {0., 0.1, 100.}, 4995.);
+
+    EventList eLog;
+    for (int i = 0; i < 5000; i++)
+      eLog += WeightedEvent(1. + ((i * 7919) % 5000 + 0.5) * 1.e-5, 0, 2., 4.);
+    run_generateHistogramUnsortedTest(eLog, {1., -0.0001, 1.1}, 9980.);
+  }
+
   void test_generateHistogramUnsortedLinear_TOF_bad_params() {
     // putting incorrect parameters in generateHistogram should not cause segfault
     const auto e = createLinearTestData();
@@ -3099,6 +3190,12 @@ public:
     el_sorted_weighted.generateHistogram(coarseX, Y, E);
   }
 
+  void test_histogram_unsorted_linear() {
+    MantidVec Y, E;
+    el_random.generateHistogram(1.0, fineX, Y, E);
+    TS_ASSERT(!el_random.isSortedByTof());
+  }
+
   void test_maskTof() {
     TS_ASSERT_EQUALS(el_sorted.getNumberEvents(), 10000000);
     el_sorted.maskTof(25e3, 75e3);
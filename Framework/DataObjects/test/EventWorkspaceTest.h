@@ -203,6 +203,24 @@ public:
     delete ew2;
   }
 
+  void test_clone() {
+    auto cloned = ew->clone();
+    TS_ASSERT_EQUALS(cloned->getNumberHistograms(), NUMPIXELS);
+    TS_ASSERT_EQUALS(cloned->getNumberEvents(), ew->getNumberEvents());
+    for (size_t pix = 0; pix < static_cast<size_t>(NUMPIXELS); pix++) {
+      const auto &original = ew->getSpectrum(pix);
+      const auto &copy = cloned->getSpectrum(pix);
+      TS_ASSERT_EQUALS(copy.getSpectrumNo(), original.getSpectrumNo());
+      TS_ASSERT(copy.hasDetectorID(static_cast<detid_t>(pix)));
+      TS_ASSERT(copy.getEvents() == original.getEvents());
+      TS_ASSERT_DIFFERS(&copy.getEvents(), &original.getEvents());
+    }
+
+    // Appending to the clone must not change the original
+    cloned->getSpectrum(0) += TofEvent(1.0, 1);
+    TS_ASSERT_EQUALS(cloned->getSpectrum(0).getNumberEvents(), ew->getSpectrum(0).getNumberEvents() + 1);
+  }
+
   void test_constructor_setting_default_x() {
     // Do the workspace, but don't set x explicity
     ew = createEventWorkspace(true, false);
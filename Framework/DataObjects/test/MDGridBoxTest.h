@@ -1011,7 +1011,16 @@ public:
   /** This test splits a large number of events, and uses a ThreadPool
    * to use all cores.
    */
-  void test_splitAllIfNeeded_usingThreadPool() {
+  void test_splitAllIfNeeded_usingThreadPool() { checkSplitAllIfNeededUsingThreadPool(0); }
+
+  /** Splitting runs on no more threads than the pool, and serially for a pool of one thread */
+  void test_splitAllIfNeeded_usingThreadPool_with_limited_threads() {
+    checkSplitAllIfNeededUsingThreadPool(1);
+    checkSplitAllIfNeededUsingThreadPool(2);
+  }
+
+  /** Split a large number of events with a ThreadPool of the given number of threads, all cores if zero */
+  void checkSplitAllIfNeededUsingThreadPool(const size_t numThreads) {
     using gbox_t = MDGridBox<MDLeanEvent<2>, 2>;
     using ibox_t = MDBoxBase<MDLeanEvent<2>, 2>;
 
@@ -1033,7 +1042,7 @@ public:
 
     // Split those boxes in parallel.
     ThreadSchedulerFIFO *ts = new ThreadSchedulerFIFO();
-    ThreadPool tp(ts);
+    ThreadPool tp(ts, numThreads);
     b->splitAllIfNeeded(ts);
     tp.joinAll();
 
@@ -775,6 +775,24 @@ public:
     checkWorkspace(a, 1.5, 1.5 * 1.5 * (.5 + 1. / 3.), 1.0);
   }
 
+  //--------------------------------------------------------------------------------------
+  void test_divide_many_bins() {
+    // enough bins to be split between several threads
+    MDHistoWorkspace_sptr a = MDEventsTestHelper::makeFakeMDHistoWorkspace(1.0, 3, 40, 10.0, 1.0);
+    MDHistoWorkspace_sptr b = MDEventsTestHelper::makeFakeMDHistoWorkspace(1.0, 3, 40, 10.0, 1.0);
+    for (size_t i = 0; i < a->getNPoints(); i++) {
+      a->setSignalAt(i, double(i));
+      b->setSignalAt(i, double(i % 7 + 1));
+    }
+    a->divide(*b);
+    for (size_t i = 0; i < a->getNPoints(); i++) {
+      const double f = double(i) / double(i % 7 + 1);
+      const double b2 = double(i % 7 + 1) * double(i % 7 + 1);
+      TS_ASSERT_DELTA(a->getSignalAt(i), f, 1e-9);
+      TS_ASSERT_DELTA(a->getErrorAt(i) * a->getErrorAt(i), 1.0 / b2 + f * f / b2, 1e-9);
+    }
+  }
+
   //--------------------------------------------------------------------------------------
   void test_exp() {
     MDHistoWorkspace_sptr a = MDEventsTestHelper::makeFakeMDHistoWorkspace(2.0, 2, 5, 10.0, 3.0);
@@ -6,6 +6,10 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorBoundingVolumeHierarchy.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/InstrumentVisitor.h"
 #include "MantidGeometry/Instrument/ReferenceFrame.h"
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidKernel/Timer.h"
@@ -613,6 +617,42 @@ public:
     TS_ASSERT_EQUALS(p2.getDetectorID(), 19999);
   }
 
+  /** Find the detectors of peaks in a batch through the detector hierarchy
+   * and compare with the ray tracer */
+  void test_findDetectors_through_hierarchy_matches_ray_tracer() {
+    const auto [componentInfo, detectorInfo] = InstrumentVisitor::makeWrappers(*inst);
+    const DetectorBoundingVolumeHierarchy hierarchy(*componentInfo, *detectorInfo);
+
+    const std::vector<int> detectorIDs{10000, 10099, 15050, 19999, 20000, 29999};
+    std::vector<Peak> traced, batched;
+    for (const auto id : detectorIDs) {
+      const V3D qLab = Peak(inst, id, 2.0).getQLabFrame();
+      traced.emplace_back(inst, qLab, std::optional<double>(1.0));
+      batched.emplace_back(inst, qLab, std::optional<double>(1.0));
+    }
+    // A back-scattered peak misses every detector
+    traced.emplace_back(inst, V3D(0.0, 0.0, 1.0), std::optional<double>(1.0));
+    batched.emplace_back(inst, V3D(0.0, 0.0, 1.0), std::optional<double>(1.0));
+
+    std::vector<Peak *> peaks;
+    for (auto &peak : batched)
+      peaks.emplace_back(&peak);
+    const auto found = Peak::findDetectors(peaks, hierarchy);
+
+    TS_ASSERT_EQUALS(found.size(), traced.size());
+    for (size_t i = 0; i < traced.size(); ++i) {
+      TS_ASSERT_EQUALS(found[i], traced[i].findDetector());
+      TS_ASSERT_EQUALS(batched[i].getDetectorID(), traced[i].getDetectorID());
+      TS_ASSERT_EQUALS(batched[i].getBankName(), traced[i].getBankName());
+    }
+    for (size_t i = 0; i < detectorIDs.size(); ++i)
+      TS_ASSERT_EQUALS(batched[i].getDetectorID(), detectorIDs[i]);
+
+    Peak single(inst, traced.front().getQLabFrame(), std::optional<double>(1.0));
+    TS_ASSERT(single.findDetector(hierarchy));
+    TS_ASSERT_EQUALS(single.getDetectorID(), detectorIDs.front());
+  }
+
   void test_getDetectorPosition() {
     const int detectorId = 19999;
     const double wavelength = 2;
@@ -0,0 +1,79 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidKernel/V3D.h"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+class ComponentInfo;
+class DetectorInfo;
+
+/** DetectorBoundingVolumeHierarchy : A tree of axis-aligned boxes over the detectors of an instrument, used to find
+  the detector a ray from a point, usually the sample, hits first without walking the component tree.
+
+  The leaves hold the detectors with a shape, each tested exactly against its shape as ObjComponent::interceptSurface
+  does, and the rectangular banks, each taken as a whole and resolved to a pixel from where the ray crosses the plane
+  of its pixel centres, as RectangularDetector::testIntersectionWithChildren does. Monitors are left out.
+
+  Queries are const and may be made from several threads at once. The tree keeps references to the ComponentInfo and
+  DetectorInfo it was built from, and copies their boxes, so it must be rebuilt whenever components move.
+ */
+class MANTID_GEOMETRY_DLL DetectorBoundingVolumeHierarchy {
+public:
+  DetectorBoundingVolumeHierarchy(const ComponentInfo &componentInfo, const DetectorInfo &detectorInfo);
+
+  /// The number of detectors and rectangular banks in the tree
+  size_t numberOfTargets() const { return m_targets.size(); }
+  /// The detectors the tree was built over, which the indices found refer to
+  const DetectorInfo &detectorInfo() const { return m_detectorInfo; }
+  std::optional<size_t> findDetector(const Kernel::V3D &start, const Kernel::V3D &direction) const;
+  std::vector<std::optional<size_t>> findDetectors(const Kernel::V3D &start,
+                                                   const std::vector<Kernel::V3D> &directions) const;
+
+private:
+  struct Box {
+    std::array<double, 3> min;
+    std::array<double, 3> max;
+  };
+  struct Node {
+    Box box;
+    /// For a leaf the first entry in m_targets, otherwise the index of the second child. The first child always
+    /// follows its parent.
+    uint32_t offset;
+    /// The number of targets in a leaf, zero for an inner node
+    uint32_t count;
+  };
+  struct Target {
+    Box box;
+    /// The index of a detector, or of a rectangular bank, in the ComponentInfo
+    size_t componentIndex;
+    bool isRectangularBank;
+  };
+
+  uint32_t build(const size_t begin, const size_t end);
+  std::optional<size_t> hitTarget(const Target &target, const Kernel::V3D &start, const Kernel::V3D &direction,
+                                  double &distance) const;
+  std::optional<size_t> hitRectangularBank(const size_t bankIndex, const Kernel::V3D &start,
+                                           const Kernel::V3D &direction, double &distance) const;
+
+  const ComponentInfo &m_componentInfo;
+  const DetectorInfo &m_detectorInfo;
+  /// The boxes of the tree in depth-first order, the root first
+  std::vector<Node> m_nodes;
+  /// The detectors and banks, ordered so that every leaf holds a contiguous range
+  std::vector<Target> m_targets;
+};
+
+} // namespace Geometry
+} // namespace Mantid
@@ -0,0 +1,55 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidGeometry/Instrument_fwd.h"
+
+#include <cstdint>
+#include <string>
+
+namespace Mantid {
+namespace Geometry {
+
+/** InstrumentCache : A binary copy of an instrument built by InstrumentDefinitionParser, so that other processes can
+  rebuild it without parsing the instrument definition file (IDF) again.
+
+  The file holds the component tree with the positions, rotations and shapes of its components, the detector IDs and
+  monitors, the source and sample, the reference frame and the parameters given in the IDF, which the parser keeps in
+  the logfile cache of the instrument. Shapes shared by many components are written once and shared again on reading.
+  Rectangular banks are written by their layout and their pixels made again by RectangularDetector::initialize.
+
+  The file is named after the mangled name of the IDF, which holds the SHA-1 checksum of the XML, and starts with the
+  mangled name, the version of the layout and the version and revision of Mantid, so a file written for another
+  definition or by another build is never used. It is kept in the instruments directory of the geometry cache directory
+  of the user, and nothing is cached when other users can write to that directory. Files are written to a unique name
+  and renamed into place so processes starting at the same time only ever read a complete file. Saving a file removes
+  those written by other builds, and ClearCache removes them all with the vtp files.
+
+  The shapes of an instrument read from the cache read their triangulation from the vtp file of the definition, as
+  those of the parser do, if the parser has written one.
+
+  Instruments holding components of other kinds, such as grid or structured detectors, and instruments with a separate
+  physical instrument are not written, and are parsed from the IDF as before.
+ */
+class MANTID_GEOMETRY_DLL InstrumentCache {
+public:
+  /// Increased whenever the layout of the file changes
+  static constexpr uint32_t FORMAT_VERSION = 2;
+
+  static bool isEnabled();
+  static Instrument_sptr load(const std::string &mangledName);
+  static bool save(const Instrument &instrument, const std::string &mangledName);
+  static bool save(const std::string &contents, const std::string &mangledName);
+  static std::string encode(const Instrument &instrument, const std::string &mangledName);
+
+  static Instrument_sptr read(const std::string &filename, const std::string &mangledName);
+  static bool write(const Instrument &instrument, const std::string &filename, const std::string &mangledName);
+};
+
+} // namespace Geometry
+} // namespace Mantid
@@ -31,6 +31,7 @@ class V3D;
 
 namespace Geometry {
 class CompGrp;
+class CompiledRules;
 class GeometryHandler;
 class Rule;
 class Surface;
@@ -170,6 +171,8 @@ public:
   void setVtkGeometryCacheWriter(std::shared_ptr<vtkGeometryCacheWriter>);
   /// set vtkGeometryCache reader
   void setVtkGeometryCacheReader(std::shared_ptr<vtkGeometryCacheReader>);
+  /// get vtkGeometryCache reader
+  const std::shared_ptr<vtkGeometryCacheReader> &getVtkGeometryCacheReader() const { return vtkCacheReader; }
   detail::ShapeInfo::GeometryShape shape() const override;
   const detail::ShapeInfo &shapeInfo() const override;
   void GetObjectGeom(detail::ShapeInfo::GeometryShape &type, std::vector<Kernel::V3D> &vectors, double &innerRadius,
@@ -199,6 +202,8 @@ private:
   double singleShotMonteCarloVolume(const int shotSize, const size_t seed) const;
   /// Top rule [ Geometric scope of object]
   std::unique_ptr<Rule> m_topRule;
+  /// Top rule compiled for point tests, or nullptr if it cannot be compiled
+  std::unique_ptr<CompiledRules> m_compiledRules;
   /// Object's bounding box
   BoundingBox m_boundingBox;
   // -- DEPRECATED --
@@ -0,0 +1,78 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/DllConfig.h"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+class V3D;
+}
+namespace Geometry {
+class CSGObject;
+class Rule;
+class Surface;
+
+/**
+  CompiledRules : A flattened form of the Rule tree of a CSGObject for fast point inclusion tests.
+
+  Every test of the tree becomes one instruction holding the instruction to go to when the test passes and when it
+  fails, so intersections, unions and complements become jumps decided when compiling, and the tests are made in the
+  same short-circuit order as Rule::isValid. The coefficients of planes, spheres, cylinders and general quadrics are
+  kept in one contiguous array and evaluated in place, so no virtual call is made for them; other surfaces are asked
+  through Surface::side. The result is the same as Rule::isValid, including the surface tolerances.
+
+  The program refers to the surfaces of the tree by pointer, and copies the coefficients of the common ones, so it must
+  be compiled again whenever the tree or its surfaces change.
+ */
+class MANTID_GEOMETRY_DLL CompiledRules {
+public:
+  static std::unique_ptr<CompiledRules> compile(const Rule *topRule);
+
+  bool isValid(const Kernel::V3D &point) const;
+  /// The number of distinct surfaces evaluated by a test
+  size_t numberOfSurfaces() const { return m_surfaces.size(); }
+
+private:
+  /// One for each kind of surface evaluated in place, then the tests made through other objects
+  enum class OpCode : uint8_t { Plane, Sphere, AxisCylinder, Quadric, Surface, ComplementObject };
+
+  struct Instruction {
+    OpCode op;
+    /// For cylinders along an axis, the axis as returned by Cylinder::getNormVec
+    uint8_t axis;
+    /// For a surface, the sign of the SurfPoint: +1 for the positive side, -1 for the negative side
+    int16_t sign;
+    /// The first coefficient of the surface in m_coefficients, or the index into m_surfaces or m_objects
+    uint32_t index;
+    /// The instruction to go to when the test passes, or VALID or INVALID
+    uint32_t onTrue;
+    /// The instruction to go to when the test fails, or VALID or INVALID
+    uint32_t onFalse;
+  };
+
+  CompiledRules() = default;
+  bool append(const Rule *rule, const uint32_t onTrue, const uint32_t onFalse, uint32_t &entry);
+  Instruction surfaceTest(const Surface *surface, const int sign);
+
+  std::vector<Instruction> m_program;
+  /// The instruction to start from
+  uint32_t m_entry{0};
+  /// The distinct surfaces of the tree, and the test of the positive side of each
+  std::vector<std::pair<const Surface *, Instruction>> m_surfaces;
+  std::vector<double> m_coefficients;
+  /// Objects complemented by the tree, which are tested through CSGObject::isValid
+  std::vector<const CSGObject *> m_objects;
+};
+
+} // namespace Geometry
+} // namespace Mantid
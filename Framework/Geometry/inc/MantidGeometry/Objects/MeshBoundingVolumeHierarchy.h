@@ -0,0 +1,59 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidKernel/V3D.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+
+/** MeshBoundingVolumeHierarchy : A tree of axis-aligned boxes over the triangles of a mesh, used to find the few
+  triangles a ray may cross without testing every one of them.
+
+  The tree is built top-down by splitting the triangles at the median of their centroids along the longest axis of
+  the box holding them, until a leaf holds no more than a handful of triangles. The boxes are padded slightly so that
+  rays grazing a triangle within the tolerance of MeshObjectCommon::rayIntersectsTriangle are never rejected.
+
+  The tree holds no reference to the mesh, so it must be rebuilt whenever the vertices move.
+ */
+class MANTID_GEOMETRY_DLL MeshBoundingVolumeHierarchy {
+public:
+  MeshBoundingVolumeHierarchy() = default;
+  MeshBoundingVolumeHierarchy(const std::vector<uint32_t> &triangles, const std::vector<Kernel::V3D> &vertices);
+
+  /// The number of boxes in the tree
+  size_t numberOfNodes() const { return m_nodes.size(); }
+  void getCandidateTriangles(const Kernel::V3D &start, const Kernel::V3D &direction,
+                             std::vector<size_t> &candidates) const;
+
+private:
+  struct Node {
+    std::array<double, 3> min;
+    std::array<double, 3> max;
+    /// For a leaf the first entry in m_triangleOrder, otherwise the index of the second child. The first child
+    /// always follows its parent.
+    uint32_t offset;
+    /// The number of triangles in a leaf, zero for an inner node
+    uint32_t count;
+  };
+
+  uint32_t build(const std::vector<std::array<double, 3>> &centroids, const std::vector<Node> &triangleBoxes,
+                 const uint32_t begin, const uint32_t end);
+
+  /// The boxes of the tree in depth-first order, the root first
+  std::vector<Node> m_nodes;
+  /// The triangle indices, ordered so that every leaf holds a contiguous range
+  std::vector<uint32_t> m_triangleOrder;
+};
+
+} // namespace Geometry
+} // namespace Mantid
@@ -12,6 +12,7 @@
 #include "BoundingBox.h"
 #include "MantidGeometry/DllConfig.h"
 #include "MantidGeometry/Objects/IObject.h"
+#include "MantidGeometry/Objects/MeshBoundingVolumeHierarchy.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidGeometry/Rendering/ShapeInfo.h"
 #include "MantidKernel/Material.h"
@@ -183,6 +184,8 @@ private:
   /// Triangles are specified by indices into a list of vertices.
   std::vector<uint32_t> m_triangles;
   std::vector<Kernel::V3D> m_vertices;
+  /// Boxes around the triangles, rebuilt whenever the vertices move
+  MeshBoundingVolumeHierarchy m_hierarchy;
   /// material composition
   Kernel::Material m_material;
 };
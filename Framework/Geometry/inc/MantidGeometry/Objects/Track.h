@@ -223,6 +223,8 @@ public:
   int nonComplete() const;
   /// Calculate attenuation across all links
   virtual double calculateAttenuation(double lambda) const;
+  /// Add the attenuation exponents across all links for a set of wavelengths
+  void addAttenuationExponents(const std::vector<double> &lambdas, std::vector<double> &exponents) const;
 
 private:
   Line m_line;        ///< Line object containing origin and direction
@@ -74,6 +74,8 @@ public:
   Kernel::V3D getCentre() const { return m_centre; } ///< Return centre point
   Kernel::V3D getNormal() const { return m_normal; } ///< Return Central line
   double getRadius() const { return m_radius; }      ///< Get Radius
+  /// The axis the cylinder lies along, 1-3 for x, y or z, or 0 for a general orientation
+  std::size_t getNormVec() const { return m_normVec; }
   /// Set Radius
   void setRadius(const double &r) {
     setRadiusInternal(r);
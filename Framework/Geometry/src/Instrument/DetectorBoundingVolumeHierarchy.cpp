@@ -0,0 +1,317 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Instrument/DetectorBoundingVolumeHierarchy.h"
+#include "MantidBeamline/ComponentType.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Objects/IObject.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/Quat.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace Mantid::Geometry {
+
+using Kernel::V3D;
+
+namespace {
+/// The largest number of targets held by a leaf
+constexpr uint32_t MAX_LEAF_SIZE{4};
+/// The padding of the boxes relative to the size of the instrument
+constexpr double RELATIVE_PADDING{1e-6};
+/// Deeper than any tree built by median splits of 2^32 targets
+constexpr size_t MAX_DEPTH{64};
+
+/**
+ * Slab test of a ray against a box
+ * @param box :: the minimum and maximum corners of the box
+ * @param start :: the start point of the ray
+ * @param direction :: the direction of the ray
+ * @param inverseDirection :: the reciprocal of each component of the direction, or zero where it is zero
+ * @param entry :: on exit the distance along the ray at which it enters the box, zero if it starts inside
+ * @return true if the ray crosses the box
+ */
+template <typename BoxType>
+bool crossesBox(const BoxType &box, const V3D &start, const V3D &direction,
+                const std::array<double, 3> &inverseDirection, double &entry) {
+  entry = 0.;
+  double exit = std::numeric_limits<double>::max();
+  for (size_t axis = 0; axis < 3; ++axis) {
+    if (direction[axis] == 0.) {
+      if (start[axis] < box.min[axis] || start[axis] > box.max[axis])
+        return false;
+      continue;
+    }
+    double t1 = (box.min[axis] - start[axis]) * inverseDirection[axis];
+    double t2 = (box.max[axis] - start[axis]) * inverseDirection[axis];
+    if (t1 > t2)
+      std::swap(t1, t2);
+    entry = std::max(entry, t1);
+    exit = std::min(exit, t2);
+    if (entry > exit)
+      return false;
+  }
+  return true;
+}
+} // namespace
+
+/**
+ * Build the tree over the detectors of an instrument
+ * @param componentInfo :: the components of the instrument
+ * @param detectorInfo :: the detectors of the instrument, used to leave out the monitors
+ */
+DetectorBoundingVolumeHierarchy::DetectorBoundingVolumeHierarchy(const ComponentInfo &componentInfo,
+                                                                 const DetectorInfo &detectorInfo)
+    : m_componentInfo(componentInfo), m_detectorInfo(detectorInfo) {
+  const auto toBox = [](const BoundingBox &boundingBox) {
+    const auto &minPoint = boundingBox.minPoint();
+    const auto &maxPoint = boundingBox.maxPoint();
+    return Box{{minPoint.X(), minPoint.Y(), minPoint.Z()}, {maxPoint.X(), maxPoint.Y(), maxPoint.Z()}};
+  };
+
+  // the pixels of a rectangular bank are found through the bank
+  std::vector<bool> inRectangularBank(detectorInfo.size(), false);
+  for (size_t index = detectorInfo.size(); index < componentInfo.size(); ++index) {
+    if (componentInfo.componentType(index) != Beamline::ComponentType::Rectangular)
+      continue;
+    m_targets.push_back({toBox(componentInfo.boundingBox(index)), index, true});
+    for (const auto detectorIndex : componentInfo.detectorsInSubtree(index))
+      inRectangularBank[detectorIndex] = true;
+  }
+  for (size_t index = 0; index < detectorInfo.size(); ++index) {
+    if (inRectangularBank[index] || detectorInfo.isMonitor(index) || !componentInfo.hasValidShape(index))
+      continue;
+    m_targets.push_back({toBox(componentInfo.boundingBox(index)), index, false});
+  }
+  if (m_targets.empty())
+    return;
+
+  // pad every box so that rays grazing a flat detector still hit it
+  Box instrument{{std::numeric_limits<double>::max(), std::numeric_limits<double>::max(),
+                  std::numeric_limits<double>::max()},
+                 {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(),
+                  std::numeric_limits<double>::lowest()}};
+  for (const auto &target : m_targets) {
+    for (size_t axis = 0; axis < 3; ++axis) {
+      instrument.min[axis] = std::min(instrument.min[axis], target.box.min[axis]);
+      instrument.max[axis] = std::max(instrument.max[axis], target.box.max[axis]);
+    }
+  }
+  const V3D instrumentSize(instrument.max[0] - instrument.min[0], instrument.max[1] - instrument.min[1],
+                           instrument.max[2] - instrument.min[2]);
+  const double padding = RELATIVE_PADDING * instrumentSize.norm() + std::numeric_limits<double>::min();
+  for (auto &target : m_targets) {
+    for (size_t axis = 0; axis < 3; ++axis) {
+      target.box.min[axis] -= padding;
+      target.box.max[axis] += padding;
+    }
+  }
+
+  m_nodes.reserve(2 * (m_targets.size() / MAX_LEAF_SIZE) + 1);
+  build(0, m_targets.size());
+}
+
+/**
+ * Add the node holding a range of m_targets, and the nodes below it, to the tree
+ * @param begin :: the first entry of m_targets held by the node
+ * @param end :: one past the last entry of m_targets held by the node
+ * @return the index of the node added
+ */
+uint32_t DetectorBoundingVolumeHierarchy::build(const size_t begin, const size_t end) {
+  Node node;
+  node.box.min.fill(std::numeric_limits<double>::max());
+  node.box.max.fill(std::numeric_limits<double>::lowest());
+  std::array<double, 3> centreMin, centreMax;
+  centreMin.fill(std::numeric_limits<double>::max());
+  centreMax.fill(std::numeric_limits<double>::lowest());
+  for (size_t i = begin; i < end; ++i) {
+    const auto &box = m_targets[i].box;
+    for (size_t axis = 0; axis < 3; ++axis) {
+      node.box.min[axis] = std::min(node.box.min[axis], box.min[axis]);
+      node.box.max[axis] = std::max(node.box.max[axis], box.max[axis]);
+      const double centre = box.min[axis] + box.max[axis];
+      centreMin[axis] = std::min(centreMin[axis], centre);
+      centreMax[axis] = std::max(centreMax[axis], centre);
+    }
+  }
+
+  const auto nodeIndex = static_cast<uint32_t>(m_nodes.size());
+  node.offset = static_cast<uint32_t>(begin);
+  node.count = static_cast<uint32_t>(end - begin);
+  m_nodes.emplace_back(node);
+
+  size_t axis = 0;
+  for (size_t i = 1; i < 3; ++i) {
+    if (centreMax[i] - centreMin[i] > centreMax[axis] - centreMin[axis])
+      axis = i;
+  }
+  // targets sharing one centre cannot be split any further
+  if (end - begin <= MAX_LEAF_SIZE || centreMax[axis] == centreMin[axis])
+    return nodeIndex;
+
+  const size_t middle = begin + (end - begin) / 2;
+  const auto byCentre = [axis](const Target &a, const Target &b) {
+    return a.box.min[axis] + a.box.max[axis] < b.box.min[axis] + b.box.max[axis];
+  };
+  std::nth_element(m_targets.begin() + begin, m_targets.begin() + middle, m_targets.begin() + end, byCentre);
+  build(begin, middle);
+  const auto secondChild = build(middle, end);
+  m_nodes[nodeIndex].offset = secondChild;
+  m_nodes[nodeIndex].count = 0;
+  return nodeIndex;
+}
+
+/**
+ * Find the detector a ray hits first
+ * @param start :: the start point of the ray
+ * @param direction :: the direction of the ray
+ * @return the index of the detector, or nothing if the ray hits no detector
+ */
+std::optional<size_t> DetectorBoundingVolumeHierarchy::findDetector(const V3D &start, const V3D &direction) const {
+  if (m_nodes.empty() || direction.nullVector())
+    return std::nullopt;
+  const V3D unitDirection = Kernel::normalize(direction);
+  std::array<double, 3> inverseDirection;
+  for (size_t axis = 0; axis < 3; ++axis)
+    inverseDirection[axis] = unitDirection[axis] != 0. ? 1. / unitDirection[axis] : 0.;
+
+  std::optional<size_t> nearest;
+  double nearestDistance = std::numeric_limits<double>::max();
+  std::array<uint32_t, MAX_DEPTH> stack;
+  size_t stackSize = 0;
+  stack[stackSize++] = 0;
+  while (stackSize > 0) {
+    const Node &node = m_nodes[stack[--stackSize]];
+    double entry(0.);
+    // a box entered beyond the nearest hit cannot hold a nearer one
+    if (!crossesBox(node.box, start, unitDirection, inverseDirection, entry) || entry > nearestDistance)
+      continue;
+    if (node.count == 0) {
+      stack[stackSize++] = node.offset;
+      stack[stackSize++] = static_cast<uint32_t>(&node - m_nodes.data()) + 1;
+      continue;
+    }
+    for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+      const auto &target = m_targets[i];
+      if (!crossesBox(target.box, start, unitDirection, inverseDirection, entry) || entry > nearestDistance)
+        continue;
+      double distance(0.);
+      const auto detector = hitTarget(target, start, unitDirection, distance);
+      if (detector && distance < nearestDistance) {
+        nearest = detector;
+        nearestDistance = distance;
+      }
+    }
+  }
+  return nearest;
+}
+
+/**
+ * Find the detector each of a set of rays from one point hits first. The rays are traced in parallel.
+ * @param start :: the start point of the rays
+ * @param directions :: the direction of each ray
+ * @return the index of the detector hit by each ray, or nothing where a ray hits no detector
+ */
+std::vector<std::optional<size_t>>
+DetectorBoundingVolumeHierarchy::findDetectors(const V3D &start, const std::vector<V3D> &directions) const {
+  std::vector<std::optional<size_t>> detectors(directions.size());
+  const auto numberOfRays = static_cast<int64_t>(directions.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numberOfRays; ++i) {
+    detectors[i] = findDetector(start, directions[i]);
+  }
+  return detectors;
+}
+
+/**
+ * Test a ray against a detector or a rectangular bank
+ * @param target :: the detector or bank
+ * @param start :: the start point of the ray
+ * @param direction :: the unit direction of the ray
+ * @param distance :: on exit, if the target is hit, the distance to the hit
+ * @return the index of the detector hit, or nothing
+ */
+std::optional<size_t> DetectorBoundingVolumeHierarchy::hitTarget(const Target &target, const V3D &start,
+                                                                 const V3D &direction, double &distance) const {
+  if (target.isRectangularBank)
+    return hitRectangularBank(target.componentIndex, start, direction, distance);
+
+  // as ObjComponent::interceptSurface, test the shape in the frame of the detector
+  const size_t index = target.componentIndex;
+  const V3D position = m_componentInfo.position(index);
+  const Kernel::Quat rotation = m_componentInfo.rotation(index);
+  Kernel::Quat unRotate(rotation);
+  unRotate.inverse();
+  V3D localStart = start - position;
+  unRotate.rotate(localStart);
+  V3D localDirection = direction;
+  unRotate.rotate(localDirection);
+  Track probe(localStart, localDirection);
+  if (m_componentInfo.shape(index).interceptSurface(probe) == 0)
+    return std::nullopt;
+
+  // the distance to where the ray leaves the detector, which orders the links of a traced Track
+  const V3D scale = m_componentInfo.scaleFactor(index);
+  distance = std::numeric_limits<double>::max();
+  for (auto link = probe.cbegin(); link != probe.cend(); ++link) {
+    V3D exitPoint = link->exitPoint;
+    rotation.rotate(exitPoint);
+    exitPoint *= scale;
+    exitPoint += position;
+    distance = std::min(distance, exitPoint.distance(start));
+  }
+  return index;
+}
+
+/**
+ * Find the pixel of a rectangular bank hit by a ray, from where the ray crosses the plane of the pixel centres, as
+ * RectangularDetector::testIntersectionWithChildren does
+ * @param bankIndex :: the index of the bank in the ComponentInfo
+ * @param start :: the start point of the ray
+ * @param direction :: the unit direction of the ray
+ * @param distance :: on exit, if a pixel is hit, the distance to the plane
+ * @return the index of the pixel hit, or nothing if the ray misses the bank or hits a monitor
+ */
+std::optional<size_t> DetectorBoundingVolumeHierarchy::hitRectangularBank(const size_t bankIndex, const V3D &start,
+                                                                          const V3D &direction,
+                                                                          double &distance) const {
+  const auto corners = m_componentInfo.quadrilateralComponent(bankIndex);
+  const V3D basePoint = m_componentInfo.position(corners.bottomLeft);
+  const V3D horizontal = m_componentInfo.position(corners.bottomRight) - basePoint;
+  const V3D vertical = m_componentInfo.position(corners.topLeft) - basePoint;
+
+  // solve start - basePoint = -t * direction + u * horizontal + v * vertical by Cramer's rule
+  const V3D beam = direction * -1.0;
+  const V3D offset = start - basePoint;
+  const V3D normal = horizontal.cross_prod(vertical);
+  const double determinant = beam.scalar_prod(normal);
+  if (determinant == 0.)
+    return std::nullopt;
+  const double t = offset.scalar_prod(normal) / determinant;
+  const double u = beam.scalar_prod(offset.cross_prod(vertical)) / determinant;
+  const double v = beam.scalar_prod(horizontal.cross_prod(offset)) / determinant;
+  if (t < 0.)
+    return std::nullopt;
+
+  // the +0.5 is because the base point is at the centre of pixel 0,0
+  const auto xIndex = static_cast<int>(static_cast<double>(corners.nX - 1) * u + 0.5);
+  const auto yIndex = static_cast<int>(static_cast<double>(corners.nY - 1) * v + 0.5);
+  if (xIndex < 0 || yIndex < 0 || xIndex >= static_cast<int>(corners.nX) || yIndex >= static_cast<int>(corners.nY))
+    return std::nullopt;
+
+  const auto &column = m_componentInfo.children(m_componentInfo.children(bankIndex)[xIndex]);
+  const size_t detectorIndex = column[yIndex];
+  if (m_detectorInfo.isMonitor(detectorIndex))
+    return std::nullopt;
+  distance = t;
+  return detectorIndex;
+}
+
+} // namespace Mantid::Geometry
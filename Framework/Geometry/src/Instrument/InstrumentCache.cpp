@@ -0,0 +1,829 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Instrument/InstrumentCache.h"
+#include "MantidGeometry/ICompAssembly.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/ObjCompAssembly.h"
+#include "MantidGeometry/Instrument/RectangularDetector.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Instrument/XMLInstrumentParameter.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/ShapeFactory.h"
+#include "MantidGeometry/Rendering/vtkGeometryCacheReader.h"
+#include "MantidKernel/BinaryStreamReader.h"
+#include "MantidKernel/BinaryStreamWriter.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Interpolation.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/MantidVersion.h"
+#include "MantidKernel/Quat.h"
+#include "MantidKernel/V2D.h"
+#include "MantidKernel/V3D.h"
+
+#include <Poco/Process.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <typeinfo>
+#include <unordered_map>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Mantid::Geometry {
+using Kernel::BinaryStreamReader;
+using Kernel::BinaryStreamWriter;
+using Kernel::ConfigService;
+using Kernel::Quat;
+using Kernel::V2D;
+using Kernel::V3D;
+
+namespace {
+Kernel::Logger g_log("InstrumentCache");
+
+/// Written at the start and at the end of every cache file
+const std::string MAGIC("MantidInstrumentCache");
+/// The extension of cache files
+const std::string EXTENSION(".instrument");
+/// The subdirectory of the geometry cache directory holding the cache files
+const std::string DIRECTORY("instruments");
+/// Written in place of the index of a missing shape or component
+constexpr uint32_t NONE{std::numeric_limits<uint32_t>::max()};
+
+/// The kinds of component which can be written
+enum class Kind : uint32_t { Component, ObjComponent, Detector, CompAssembly, ObjCompAssembly, RectangularDetector };
+
+/// The kind of a component, or nothing if it cannot be written. Only the exact classes are accepted, as a derived class
+/// may hold more than is written.
+std::optional<Kind> kindOf(const IComponent &component) {
+  const auto &type = typeid(component);
+  if (type == typeid(Component))
+    return Kind::Component;
+  if (type == typeid(ObjComponent))
+    return Kind::ObjComponent;
+  if (type == typeid(Detector))
+    return Kind::Detector;
+  if (type == typeid(CompAssembly))
+    return Kind::CompAssembly;
+  if (type == typeid(ObjCompAssembly))
+    return Kind::ObjCompAssembly;
+  if (type == typeid(RectangularDetector))
+    return Kind::RectangularDetector;
+  return std::nullopt;
+}
+
+/// The axis a unit vector points along
+PointingAlong axisOf(const V3D &direction) {
+  if (direction.X() != 0.0)
+    return X;
+  return direction.Y() != 0.0 ? Y : Z;
+}
+
+/// The build of Mantid which wrote a file. A file is only read by the same build, as the parser or the geometry classes
+/// may have changed the instrument it builds.
+std::string buildVersion() {
+  return Kernel::MantidVersion::version() + " " + Kernel::MantidVersion::revisionFull();
+}
+
+/// The start of every file written by this build, see Writer::write
+std::string headerOfThisBuild() {
+  std::ostringstream header;
+  BinaryStreamWriter out(header);
+  out << MAGIC << InstrumentCache::FORMAT_VERSION << buildVersion();
+  return header.str();
+}
+
+/// Remove the files of the cache directory written by other builds, which are never read again
+void removeFilesOfOtherBuilds(const std::filesystem::path &directory) {
+  const std::string header = headerOfThisBuild();
+  std::error_code error;
+  for (std::filesystem::directory_iterator entry(directory, error), end; !error && entry != end;
+       entry.increment(error)) {
+    const auto &path = entry->path();
+    if (path.extension() != EXTENSION)
+      continue;
+    std::string start(header.size(), '\0');
+    {
+      std::ifstream file(path, std::ios::binary);
+      file.read(start.data(), static_cast<std::streamsize>(start.size()));
+      if (file && start == header)
+        continue;
+    }
+    std::error_code removeError;
+    if (std::filesystem::remove(path, removeError))
+      g_log.debug() << "Removed the instrument cache " << path.string() << " written by another build\n";
+  }
+}
+
+/**
+ * Write a cache file. The file is written under a name unique to this process and renamed, so other processes never
+ * see a partly written file.
+ * @param contents :: the contents of the file
+ * @param filename :: the path of the file
+ * @return true if the file was written
+ */
+bool writeFile(const std::string &contents, const std::string &filename) {
+  const std::string partial = filename + "." + std::to_string(Poco::Process::id()) + ".part";
+  {
+    std::ofstream file(partial, std::ios::binary | std::ios::trunc);
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    if (!file) {
+      g_log.warning() << "Cannot write the instrument cache " << filename << '\n';
+      std::error_code error;
+      std::filesystem::remove(partial, error);
+      return false;
+    }
+  }
+  std::error_code error;
+  std::filesystem::rename(partial, filename, error);
+  if (error) {
+    g_log.warning() << "Cannot write the instrument cache " << filename << ": " << error.message() << '\n';
+    std::filesystem::remove(partial, error);
+    return false;
+  }
+  g_log.information() << "Saved the instrument in " << filename << '\n';
+  return true;
+}
+
+/// Whether only the current user can write to a directory, so the files in it can be trusted
+bool isPrivateDirectory(const std::filesystem::path &directory) {
+  std::error_code error;
+  if (!std::filesystem::is_directory(directory, error))
+    return false;
+#ifdef _WIN32
+  // the geometry cache directory is in the application data of the user
+  return true;
+#else
+  struct stat status;
+  if (::stat(directory.c_str(), &status) != 0)
+    return false;
+  return status.st_uid == ::geteuid() && (status.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+#endif
+}
+
+/// The directory of the cache files, within the geometry cache directory of the user
+std::filesystem::path cacheDirectory() {
+  return std::filesystem::path(ConfigService::Instance().getVTPFileDirectory()) / DIRECTORY;
+}
+
+/// Writes an instrument, collecting its shapes while the component tree is written so they can be written first
+class Writer {
+public:
+  explicit Writer(const Instrument &instrument) : m_instrument(instrument), m_tree(m_treeBuffer) {}
+  bool write(std::ostream &stream, const std::string &mangledName);
+
+private:
+  bool writeComponent(const IComponent &component);
+  bool writeChildren(const ICompAssembly &assembly);
+  void writePlacement(const IComponent &component);
+  bool writeShape(const std::shared_ptr<const IObject> &shape);
+  void addIndices(const IComponent &component);
+  bool writeParameters(BinaryStreamWriter &out);
+  uint32_t indexOf(const IComponent *component) const;
+
+  const Instrument &m_instrument;
+  std::ostringstream m_treeBuffer;
+  BinaryStreamWriter m_tree;
+  /// The shapes of the tree in the order they are first met, and the index of each
+  std::vector<const CSGObject *> m_shapes;
+  std::unordered_map<const IObject *, uint32_t> m_shapeIndices;
+  /// The index of every component in the order the tree is written, generated pixels included
+  std::unordered_map<const IComponent *, uint32_t> m_indices;
+};
+
+/**
+ * Write the instrument
+ * @param stream :: the stream to write to
+ * @param mangledName :: the mangled name of the instrument definition
+ * @return false if the instrument holds something which cannot be written, in which case nothing is written
+ */
+bool Writer::write(std::ostream &stream, const std::string &mangledName) {
+  if (m_instrument.isParametrized() || m_instrument.getPhysicalInstrument())
+    return false;
+  m_indices.emplace(&m_instrument, 0);
+  writePlacement(m_instrument);
+  if (!writeChildren(m_instrument))
+    return false;
+
+  std::ostringstream bodyBuffer;
+  BinaryStreamWriter body(bodyBuffer);
+  body << m_instrument.getName() << m_instrument.getValidFromDate().totalNanoseconds()
+       << m_instrument.getValidToDate().totalNanoseconds() << m_instrument.getDefaultView()
+       << m_instrument.getDefaultAxis();
+  const auto frame = m_instrument.getReferenceFrame();
+  body << static_cast<uint32_t>(frame->pointingUp()) << static_cast<uint32_t>(frame->pointingAlongBeam())
+       << static_cast<uint32_t>(axisOf(frame->vecThetaSign())) << static_cast<uint32_t>(frame->getHandedness())
+       << frame->origin();
+  const auto &units = m_instrument.getLogfileUnit();
+  body << static_cast<uint32_t>(units.size());
+  for (const auto &unit : units)
+    body << unit.first << unit.second;
+
+  body << static_cast<uint32_t>(m_shapes.size());
+  for (const auto *shape : m_shapes)
+    body << static_cast<int32_t>(shape->getName()) << shape->getShapeXML();
+  const std::string tree = m_treeBuffer.str();
+  body.write(tree, tree.size());
+  body << (m_instrument.hasSource() ? indexOf(m_instrument.getSource().get()) : NONE)
+       << (m_instrument.hasSample() ? indexOf(m_instrument.getSample().get()) : NONE);
+  if (!writeParameters(body))
+    return false;
+
+  const std::string contents = bodyBuffer.str();
+  BinaryStreamWriter out(stream);
+  out << MAGIC << InstrumentCache::FORMAT_VERSION << buildVersion() << mangledName
+      << static_cast<int64_t>(contents.size());
+  out.write(contents, contents.size());
+  out << MAGIC;
+  return true;
+}
+
+/**
+ * Write a component and, for an assembly, its children
+ * @param component :: the component to write
+ * @return false if the component, or one below it, cannot be written
+ */
+bool Writer::writeComponent(const IComponent &component) {
+  const auto kind = kindOf(component);
+  if (!kind)
+    return false;
+  m_indices.emplace(&component, static_cast<uint32_t>(m_indices.size()));
+  m_tree << static_cast<uint32_t>(*kind) << component.getName();
+  writePlacement(component);
+
+  switch (*kind) {
+  case Kind::Component:
+    return true;
+  case Kind::ObjComponent:
+    return writeShape(dynamic_cast<const ObjComponent &>(component).shape());
+  case Kind::Detector: {
+    const auto &detector = dynamic_cast<const Detector &>(component);
+    m_tree << static_cast<int32_t>(detector.getID()) << static_cast<uint32_t>(m_instrument.isMonitor(detector.getID()));
+    return writeShape(detector.shape());
+  }
+  case Kind::CompAssembly:
+    return writeChildren(dynamic_cast<const CompAssembly &>(component));
+  case Kind::ObjCompAssembly: {
+    const auto &assembly = dynamic_cast<const ObjCompAssembly &>(component);
+    return writeShape(assembly.shape()) && writeChildren(assembly);
+  }
+  case Kind::RectangularDetector: {
+    // the pixels are made again from the layout of the bank, so only their shape and rotations are written
+    const auto &bank = dynamic_cast<const RectangularDetector &>(component);
+    const bool hasPixels = bank.xpixels() > 0 && bank.ypixels() > 0;
+    if (!writeShape(hasPixels ? bank.getAtXY(0, 0)->shape() : nullptr))
+      return false;
+    m_tree << static_cast<int32_t>(bank.xpixels()) << bank.xstart() << bank.xstep()
+           << static_cast<int32_t>(bank.ypixels()) << bank.ystart() << bank.ystep()
+           << static_cast<int32_t>(bank.idstart()) << static_cast<uint32_t>(bank.idfillbyfirst_y())
+           << static_cast<int32_t>(bank.idstepbyrow()) << static_cast<int32_t>(bank.idstep());
+    for (int i = 0; i < bank.nelements(); ++i)
+      addIndices(*bank.getChild(i));
+    for (int x = 0; x < bank.xpixels(); ++x) {
+      for (int y = 0; y < bank.ypixels(); ++y) {
+        const Quat rotation = bank.getAtXY(x, y)->getRelativeRot();
+        m_tree << rotation.real() << rotation.imagI() << rotation.imagJ() << rotation.imagK();
+      }
+    }
+    return true;
+  }
+  }
+  return false;
+}
+
+/**
+ * Write the children of an assembly
+ * @param assembly :: the assembly
+ * @return false if one of the children cannot be written
+ */
+bool Writer::writeChildren(const ICompAssembly &assembly) {
+  m_tree << static_cast<uint32_t>(assembly.nelements());
+  for (int i = 0; i < assembly.nelements(); ++i) {
+    if (!writeComponent(*assembly.getChild(i)))
+      return false;
+  }
+  return true;
+}
+
+/// Write the position and rotation relative to the parent, and the position in the side-by-side view if there is one
+void Writer::writePlacement(const IComponent &component) {
+  const V3D position = component.getRelativePos();
+  const Quat rotation = component.getRelativeRot();
+  m_tree << position.X() << position.Y() << position.Z() << rotation.real() << rotation.imagI() << rotation.imagJ()
+         << rotation.imagK();
+  const auto sideBySide = component.getSideBySideViewPos();
+  m_tree << static_cast<uint32_t>(sideBySide.has_value());
+  if (sideBySide)
+    m_tree << sideBySide->X() << sideBySide->Y();
+}
+
+/**
+ * Write the index of a shape, adding it to the shapes of the instrument the first time it is met
+ * @param shape :: the shape, which may be null
+ * @return false if the shape cannot be written
+ */
+bool Writer::writeShape(const std::shared_ptr<const IObject> &shape) {
+  if (!shape) {
+    m_tree << NONE;
+    return true;
+  }
+  const auto known = m_shapeIndices.find(shape.get());
+  if (known != m_shapeIndices.end()) {
+    m_tree << known->second;
+    return true;
+  }
+  // only shapes made from XML can be made again
+  const auto *csgShape = dynamic_cast<const CSGObject *>(shape.get());
+  if (!csgShape || typeid(*csgShape) != typeid(CSGObject))
+    return false;
+  const auto index = static_cast<uint32_t>(m_shapes.size());
+  m_shapes.emplace_back(csgShape);
+  m_shapeIndices.emplace(shape.get(), index);
+  m_tree << index;
+  return true;
+}
+
+/// Give an index to a component made again when reading, and to the components below it
+void Writer::addIndices(const IComponent &component) {
+  m_indices.emplace(&component, static_cast<uint32_t>(m_indices.size()));
+  if (const auto *assembly = dynamic_cast<const ICompAssembly *>(&component)) {
+    for (int i = 0; i < assembly->nelements(); ++i)
+      addIndices(*assembly->getChild(i));
+  }
+}
+
+/**
+ * Write the parameters given in the instrument definition
+ * @param out :: the writer to write to
+ * @return false if a parameter refers to a component outside the tree
+ */
+bool Writer::writeParameters(BinaryStreamWriter &out) {
+  const auto &parameters = m_instrument.getLogfileCache();
+  out << static_cast<uint32_t>(parameters.size());
+  for (const auto &[key, parameter] : parameters) {
+    const uint32_t keyIndex = indexOf(key.second);
+    const uint32_t componentIndex = indexOf(parameter->m_component);
+    if (keyIndex == NONE || componentIndex == NONE)
+      return false;
+    out << key.first << keyIndex << componentIndex << parameter->m_logfileID << parameter->m_value
+        << parameter->m_paramName << parameter->m_type << parameter->m_tie;
+    out << static_cast<uint32_t>(parameter->m_constraint.size());
+    for (const auto &constraint : parameter->m_constraint)
+      out << constraint;
+    out << parameter->m_penaltyFactor << parameter->m_fittingFunction << parameter->m_formula
+        << parameter->m_formulaUnit << parameter->m_resultUnit << parameter->m_extractSingleValueAs << parameter->m_eq
+        << parameter->m_angleConvertConst << parameter->m_description << parameter->m_visible;
+    out << static_cast<uint32_t>(parameter->m_interpolation != nullptr);
+    if (parameter->m_interpolation) {
+      // written as text, which Interpolation reads back, at full precision
+      std::ostringstream interpolation;
+      interpolation << std::setprecision(std::numeric_limits<double>::max_digits10) << *parameter->m_interpolation;
+      out << interpolation.str();
+    }
+  }
+  return true;
+}
+
+/// The index of a component, NONE for a null component and for one outside the tree
+uint32_t Writer::indexOf(const IComponent *component) const {
+  const auto index = m_indices.find(component);
+  return index != m_indices.end() ? index->second : NONE;
+}
+
+/// Reads an instrument written by Writer
+class Reader {
+public:
+  explicit Reader(std::istream &stream) : m_stream(stream), m_in(stream) {}
+  Instrument_sptr read(const std::string &mangledName, const std::streamoff size);
+
+private:
+  /// The placement of a component, see Writer::writePlacement
+  struct Placement {
+    V3D position;
+    Quat rotation;
+    std::optional<V2D> sideBySide;
+  };
+
+  void readComponent(ICompAssembly &parent);
+  void readChildren(ICompAssembly &assembly);
+  Placement readPlacement();
+  void place(IComponent &component, const Placement &placement);
+  Quat readRotation();
+  std::shared_ptr<IObject> readShape();
+  void attachGeometryCache(const std::string &mangledName);
+  void readParameters();
+  void addIndices(const IComponent &component);
+  const IComponent *componentAt(const uint32_t index) const;
+  template <typename T> T get() {
+    T value{};
+    m_in >> value;
+    return value;
+  }
+
+  std::istream &m_stream;
+  BinaryStreamReader m_in;
+  Instrument_sptr m_instrument;
+  std::vector<std::shared_ptr<IObject>> m_shapes;
+  /// Every component in the order the tree was written, generated pixels included
+  std::vector<const IComponent *> m_components;
+};
+
+/**
+ * Read an instrument
+ * @param mangledName :: the mangled name of the instrument definition the file must have been written for
+ * @param size :: the size of the file
+ * @return the instrument, or null if the file was written for another definition or by another build
+ * @throw std::runtime_error if the file is incomplete
+ */
+Instrument_sptr Reader::read(const std::string &mangledName, const std::streamoff size) {
+  if (get<std::string>() != MAGIC || get<uint32_t>() != InstrumentCache::FORMAT_VERSION ||
+      get<std::string>() != buildVersion() || get<std::string>() != mangledName)
+    return nullptr;
+  // the contents must fill the rest of the file but the end marker
+  const auto contentsSize = get<int64_t>();
+  const auto endMarkerSize = static_cast<std::streamoff>(sizeof(int32_t) + MAGIC.size());
+  if (!m_stream || contentsSize != size - m_stream.tellg() - endMarkerSize)
+    throw std::runtime_error("The file is incomplete");
+
+  m_instrument = std::make_shared<Instrument>(get<std::string>());
+  m_instrument->setValidFromDate(Types::Core::DateAndTime(get<int64_t>()));
+  m_instrument->setValidToDate(Types::Core::DateAndTime(get<int64_t>()));
+  m_instrument->setDefaultView(get<std::string>());
+  m_instrument->setDefaultViewAxis(get<std::string>());
+  const auto up = static_cast<PointingAlong>(get<uint32_t>());
+  const auto alongBeam = static_cast<PointingAlong>(get<uint32_t>());
+  const auto thetaSign = static_cast<PointingAlong>(get<uint32_t>());
+  const auto handedness = static_cast<Handedness>(get<uint32_t>());
+  m_instrument->setReferenceFrame(
+      std::make_shared<ReferenceFrame>(up, alongBeam, thetaSign, handedness, get<std::string>()));
+  auto &units = m_instrument->getLogfileUnit();
+  for (auto count = get<uint32_t>(); count > 0; --count) {
+    auto name = get<std::string>();
+    units[name] = get<std::string>();
+  }
+
+  ShapeFactory shapeFactory;
+  m_shapes.resize(get<uint32_t>());
+  for (auto &shape : m_shapes) {
+    const auto name = get<int32_t>();
+    const auto xml = get<std::string>();
+    auto csgShape = xml.empty() ? std::make_shared<CSGObject>() : shapeFactory.createShape(xml, false);
+    csgShape->setName(name);
+    shape = std::move(csgShape);
+  }
+  attachGeometryCache(mangledName);
+
+  m_components.emplace_back(m_instrument.get());
+  place(*m_instrument, readPlacement());
+  readChildren(*m_instrument);
+  if (const auto *source = componentAt(get<uint32_t>()))
+    m_instrument->markAsSource(source);
+  if (const auto *sample = componentAt(get<uint32_t>()))
+    m_instrument->markAsSamplePos(sample);
+  m_instrument->markAsDetectorFinalize();
+  readParameters();
+
+  if (get<std::string>() != MAGIC || !m_stream)
+    throw std::runtime_error("The file does not end with the end marker");
+  return m_instrument;
+}
+
+/**
+ * Read a component and add it to its parent
+ * @param parent :: the assembly the component belongs to
+ */
+void Reader::readComponent(ICompAssembly &parent) {
+  const auto kind = static_cast<Kind>(get<uint32_t>());
+  const auto name = get<std::string>();
+  const auto placement = readPlacement();
+  switch (kind) {
+  case Kind::Component: {
+    auto *component = new Component(name, &parent);
+    parent.add(component);
+    m_components.emplace_back(component);
+    place(*component, placement);
+    break;
+  }
+  case Kind::ObjComponent: {
+    auto *component = new ObjComponent(name, readShape(), &parent);
+    parent.add(component);
+    m_components.emplace_back(component);
+    place(*component, placement);
+    break;
+  }
+  case Kind::Detector: {
+    const auto id = get<int32_t>();
+    const bool isMonitor = get<uint32_t>() != 0;
+    auto *detector = new Detector(name, id, readShape(), &parent);
+    parent.add(detector);
+    m_components.emplace_back(detector);
+    place(*detector, placement);
+    if (isMonitor)
+      m_instrument->markAsMonitorIncomplete(detector);
+    else
+      m_instrument->markAsDetectorIncomplete(detector);
+    break;
+  }
+  case Kind::CompAssembly: {
+    // assemblies add themselves to their parent
+    auto *assembly = new CompAssembly(name, &parent);
+    m_components.emplace_back(assembly);
+    place(*assembly, placement);
+    readChildren(*assembly);
+    break;
+  }
+  case Kind::ObjCompAssembly: {
+    auto *assembly = new ObjCompAssembly(name, &parent);
+    m_components.emplace_back(assembly);
+    place(*assembly, placement);
+    assembly->setOutline(readShape());
+    readChildren(*assembly);
+    break;
+  }
+  case Kind::RectangularDetector: {
+    auto *bank = new RectangularDetector(name, &parent);
+    m_components.emplace_back(bank);
+    place(*bank, placement);
+    const auto shape = readShape();
+    const auto xpixels = get<int32_t>();
+    const auto xstart = get<double>();
+    const auto xstep = get<double>();
+    const auto ypixels = get<int32_t>();
+    const auto ystart = get<double>();
+    const auto ystep = get<double>();
+    const auto idstart = get<int32_t>();
+    const bool idfillbyfirst_y = get<uint32_t>() != 0;
+    const auto idstepbyrow = get<int32_t>();
+    const auto idstep = get<int32_t>();
+    bank->initialize(shape, xpixels, xstart, xstep, ypixels, ystart, ystep, idstart, idfillbyfirst_y, idstepbyrow,
+                     idstep);
+    for (int i = 0; i < bank->nelements(); ++i)
+      addIndices(*bank->getChild(i));
+    for (int x = 0; x < xpixels; ++x) {
+      for (int y = 0; y < ypixels; ++y) {
+        const auto pixel = bank->getAtXY(x, y);
+        pixel->setRot(readRotation());
+        m_instrument->markAsDetectorIncomplete(pixel.get());
+      }
+    }
+    break;
+  }
+  default:
+    throw std::runtime_error("Unknown kind of component");
+  }
+}
+
+/// Read the children of an assembly
+void Reader::readChildren(ICompAssembly &assembly) {
+  for (auto count = get<uint32_t>(); count > 0; --count)
+    readComponent(assembly);
+}
+
+/// Read the placement of a component written by Writer::writePlacement
+Reader::Placement Reader::readPlacement() {
+  Placement placement;
+  const auto x = get<double>();
+  const auto y = get<double>();
+  const auto z = get<double>();
+  placement.position = V3D(x, y, z);
+  placement.rotation = readRotation();
+  if (get<uint32_t>() != 0) {
+    const auto sideBySideX = get<double>();
+    const auto sideBySideY = get<double>();
+    placement.sideBySide = V2D(sideBySideX, sideBySideY);
+  }
+  return placement;
+}
+
+/// Move a component to where it was when written
+void Reader::place(IComponent &component, const Placement &placement) {
+  component.setPos(placement.position);
+  component.setRot(placement.rotation);
+  if (placement.sideBySide)
+    component.setSideBySideViewPos(*placement.sideBySide);
+}
+
+/// Read a rotation written as its four components
+Quat Reader::readRotation() {
+  const auto w = get<double>();
+  const auto a = get<double>();
+  const auto b = get<double>();
+  const auto c = get<double>();
+  return Quat(w, a, b, c);
+}
+
+/// Read the index of a shape and return the shape
+std::shared_ptr<IObject> Reader::readShape() {
+  const auto index = get<uint32_t>();
+  if (index == NONE)
+    return nullptr;
+  if (index >= m_shapes.size())
+    throw std::runtime_error("Unknown shape");
+  return m_shapes[index];
+}
+
+/**
+ * Let the shapes read their triangulation from the vtp file InstrumentDefinitionParser wrote for the definition, looked
+ * for where InstrumentDefinitionParser::setupGeometryCache looks for it
+ * @param mangledName :: the mangled name of the instrument definition
+ */
+void Reader::attachGeometryCache(const std::string &mangledName) {
+  if (m_shapes.empty())
+    return;
+  auto &config = ConfigService::Instance();
+  for (const auto &directory : {config.getVTPFileDirectory(), config.getTempDir()}) {
+    const auto filename = std::filesystem::path(directory) / (mangledName + ".vtp");
+    std::error_code error;
+    if (!std::filesystem::exists(filename, error))
+      continue;
+    g_log.information() << "Loading geometry cache from " << filename.string() << '\n';
+    const auto reader = std::make_shared<vtkGeometryCacheReader>(filename.string());
+    for (const auto &shape : m_shapes) {
+      if (auto csgShape = std::dynamic_pointer_cast<CSGObject>(shape))
+        csgShape->setVtkGeometryCacheReader(reader);
+    }
+    return;
+  }
+}
+
+/// Read the parameters given in the instrument definition, see Writer::writeParameters
+void Reader::readParameters() {
+  auto &parameters = m_instrument->getLogfileCache();
+  for (auto count = get<uint32_t>(); count > 0; --count) {
+    const auto keyName = get<std::string>();
+    const auto *keyComponent = componentAt(get<uint32_t>());
+    const auto *component = componentAt(get<uint32_t>());
+    const auto logfileID = get<std::string>();
+    const auto value = get<std::string>();
+    const auto paramName = get<std::string>();
+    const auto type = get<std::string>();
+    const auto tie = get<std::string>();
+    std::vector<std::string> constraint(get<uint32_t>());
+    for (auto &bound : constraint)
+      bound = get<std::string>();
+    auto penaltyFactor = get<std::string>();
+    const auto fittingFunction = get<std::string>();
+    const auto formula = get<std::string>();
+    const auto formulaUnit = get<std::string>();
+    const auto resultUnit = get<std::string>();
+    const auto extractSingleValueAs = get<std::string>();
+    const auto eq = get<std::string>();
+    const auto angleConvertConst = get<double>();
+    const auto description = get<std::string>();
+    const auto visible = get<std::string>();
+    std::shared_ptr<Kernel::Interpolation> interpolation;
+    if (get<uint32_t>() != 0) {
+      interpolation = std::make_shared<Kernel::Interpolation>();
+      std::istringstream text(get<std::string>());
+      text >> *interpolation;
+    }
+    parameters.emplace(std::make_pair(keyName, keyComponent),
+                       std::make_shared<XMLInstrumentParameter>(
+                           logfileID, value, interpolation, formula, formulaUnit, resultUnit, paramName, type, tie,
+                           constraint, penaltyFactor, fittingFunction, extractSingleValueAs, eq, component,
+                           angleConvertConst, description, visible));
+  }
+}
+
+/// Give an index to a component made again from the layout of a bank, and to the components below it
+void Reader::addIndices(const IComponent &component) {
+  m_components.emplace_back(&component);
+  if (const auto *assembly = dynamic_cast<const ICompAssembly *>(&component)) {
+    for (int i = 0; i < assembly->nelements(); ++i)
+      addIndices(*assembly->getChild(i));
+  }
+}
+
+/// The component at an index, null for NONE
+const IComponent *Reader::componentAt(const uint32_t index) const {
+  if (index == NONE)
+    return nullptr;
+  if (index >= m_components.size())
+    throw std::runtime_error("Unknown component");
+  return m_components[index];
+}
+} // namespace
+
+/// Whether instruments are cached, as set by instrumentDefinition.binaryCache, on by default
+bool InstrumentCache::isEnabled() {
+  return ConfigService::Instance().getValue<bool>("instrumentDefinition.binaryCache").value_or(true);
+}
+
+/**
+ * Load an instrument from the cache directory
+ * @param mangledName :: the mangled name of the instrument definition, see InstrumentDefinitionParser::getMangledName
+ * @return the instrument, or null if the cache is disabled or holds no valid file for the definition
+ */
+Instrument_sptr InstrumentCache::load(const std::string &mangledName) {
+  if (mangledName.empty() || !isEnabled())
+    return nullptr;
+  const auto directory = cacheDirectory();
+  const auto filename = directory / (mangledName + EXTENSION);
+  std::error_code error;
+  if (!std::filesystem::exists(filename, error) || !isPrivateDirectory(directory))
+    return nullptr;
+  auto instrument = read(filename.string(), mangledName);
+  if (instrument)
+    g_log.information() << "Loaded the instrument from " << filename.string() << '\n';
+  return instrument;
+}
+
+/**
+ * Save an instrument in the cache directory, see save(contents, mangledName)
+ * @param instrument :: the instrument as built by InstrumentDefinitionParser
+ * @param mangledName :: the mangled name of the instrument definition, see InstrumentDefinitionParser::getMangledName
+ * @return true if the instrument was saved
+ */
+bool InstrumentCache::save(const Instrument &instrument, const std::string &mangledName) {
+  if (mangledName.empty() || !isEnabled())
+    return false;
+  return save(encode(instrument, mangledName), mangledName);
+}
+
+/**
+ * Save the cache file of an instrument in the cache directory, which is made if it does not exist, removing the files
+ * written by other builds. Nothing is saved if other users can write to the directory.
+ * @param contents :: the contents of the file, see encode
+ * @param mangledName :: the mangled name of the instrument definition, see InstrumentDefinitionParser::getMangledName
+ * @return true if the instrument was saved
+ */
+bool InstrumentCache::save(const std::string &contents, const std::string &mangledName) {
+  if (contents.empty() || mangledName.empty() || !isEnabled())
+    return false;
+  const auto directory = cacheDirectory();
+  std::error_code error;
+  if (std::filesystem::create_directory(directory, error))
+    std::filesystem::permissions(directory, std::filesystem::perms::owner_all, error);
+  if (!isPrivateDirectory(directory)) {
+    g_log.debug() << "Instruments are not cached as " << directory.string() << " is not private to the user\n";
+    return false;
+  }
+  removeFilesOfOtherBuilds(directory);
+  return writeFile(contents, (directory / (mangledName + EXTENSION)).string());
+}
+
+/**
+ * The contents of the cache file of an instrument. Encoding only reads the instrument, so it can be done while the
+ * instrument cannot change and the file written later.
+ * @param instrument :: the instrument as built by InstrumentDefinitionParser
+ * @param mangledName :: the mangled name of the instrument definition
+ * @return the contents, empty if the instrument holds components which cannot be cached
+ */
+std::string InstrumentCache::encode(const Instrument &instrument, const std::string &mangledName) {
+  std::ostringstream contents;
+  Writer writer(instrument);
+  if (!writer.write(contents, mangledName)) {
+    g_log.debug() << "The instrument " << instrument.getName() << " holds components which cannot be cached\n";
+    return "";
+  }
+  return contents.str();
+}
+
+/**
+ * Read an instrument from a cache file
+ * @param filename :: the path of the file
+ * @param mangledName :: the mangled name of the instrument definition the file must have been written for
+ * @return the instrument, or null if the file cannot be read or was written for another definition or another build
+ */
+Instrument_sptr InstrumentCache::read(const std::string &filename, const std::string &mangledName) {
+  // the whole file is read at once, and the instrument built from memory
+  std::ifstream file(filename, std::ios::binary);
+  if (!file)
+    return nullptr;
+  std::stringstream contents;
+  contents << file.rdbuf();
+  const auto size = static_cast<std::streamoff>(contents.str().size());
+  try {
+    Reader reader(contents);
+    return reader.read(mangledName, size);
+  } catch (std::exception &e) {
+    g_log.warning() << "Cannot read the instrument cache " << filename << ": " << e.what() << '\n';
+    return nullptr;
+  }
+}
+
+/**
+ * Write an instrument to a cache file. The file is written under a name unique to this process and renamed, so other
+ * processes never see a partly written file.
+ * @param instrument :: the instrument as built by InstrumentDefinitionParser
+ * @param filename :: the path of the file
+ * @param mangledName :: the mangled name of the instrument definition
+ * @return true if the instrument was written, false if it holds components which cannot be cached or writing failed
+ */
+bool InstrumentCache::write(const Instrument &instrument, const std::string &filename, const std::string &mangledName) {
+  const auto contents = encode(instrument, mangledName);
+  return !contents.empty() && writeFile(contents, filename);
+}
+
+} // namespace Mantid::Geometry
@@ -5,6 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/CompiledRules.h"
 
 #include "MantidGeometry/Objects/Rules.h"
 #include "MantidGeometry/Objects/Track.h"
@@ -549,6 +550,7 @@ int CSGObject::hasComplement() const {
  * @retval 0 :: successfully populated all the whole Object.
  */
 int CSGObject::populate(const std::map<int, std::shared_ptr<Surface>> &surfMap) {
+  m_compiledRules.reset();
   std::deque<Rule *> rules;
   rules.emplace_back(m_topRule.get());
   while (!rules.empty()) {
@@ -740,6 +742,8 @@ int CSGObject::checkSurfaceValid(const Kernel::V3D &point, const Kernel::V3D &di
 bool CSGObject::isValid(const Kernel::V3D &point) const {
   if (!m_topRule)
     return false;
+  if (m_compiledRules)
+    return m_compiledRules->isValid(point);
   return m_topRule->isValid(point);
 }
 
@@ -793,6 +797,8 @@ int CSGObject::createSurfaceList(const int outFlag) {
     };
   });
   m_surList.erase(newEnd, m_surList.end());
+  // the surfaces or the tree have changed
+  m_compiledRules = CompiledRules::compile(m_topRule.get());
 
   if (outFlag) {
 
@@ -893,6 +899,7 @@ void CSGObject::print() const {
 void CSGObject::makeComplement() {
   std::unique_ptr<Rule> NCG = procComp(std::move(m_topRule));
   m_topRule = std::move(NCG);
+  m_compiledRules = CompiledRules::compile(m_topRule.get());
 }
 
 /**
@@ -948,6 +955,7 @@ void CSGObject::write(std::ostream &outStream) const {
  */
 void CSGObject::procString(const std::string &lineStr) {
   m_topRule = nullptr;
+  m_compiledRules.reset();
   std::map<int, std::unique_ptr<Rule>> RuleList; // List for the rules
   int Ridx = 0;                                  // Current index (not necessary size of RuleList
   // SURFACE REPLACEMENT
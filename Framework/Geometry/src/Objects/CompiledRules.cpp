@@ -0,0 +1,217 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Objects/CompiledRules.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/Rules.h"
+#include "MantidGeometry/Surfaces/Cylinder.h"
+#include "MantidGeometry/Surfaces/General.h"
+#include "MantidGeometry/Surfaces/Plane.h"
+#include "MantidGeometry/Surfaces/Sphere.h"
+#include "MantidKernel/Tolerance.h"
+#include "MantidKernel/V3D.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <typeinfo>
+
+namespace Mantid::Geometry {
+using Kernel::Tolerance;
+
+namespace {
+/// The end of the program for a valid point
+constexpr uint32_t VALID{std::numeric_limits<uint32_t>::max()};
+/// The end of the program for an invalid point
+constexpr uint32_t INVALID{VALID - 1};
+
+/// The side of a surface from the value of its equation, or the displacement from it, as Surface::side gives
+inline int sideOf(const double value) {
+  if (std::fabs(value) < Tolerance)
+    return 0;
+  return (value > 0.0) ? 1 : -1;
+}
+} // namespace
+
+/**
+ * Compile a rule tree
+ * @param topRule :: the root of the tree
+ * @return the compiled tree, or nullptr if the tree holds a rule which cannot be compiled
+ */
+std::unique_ptr<CompiledRules> CompiledRules::compile(const Rule *topRule) {
+  if (!topRule)
+    return nullptr;
+  std::unique_ptr<CompiledRules> compiled(new CompiledRules());
+  if (!compiled->append(topRule, VALID, INVALID, compiled->m_entry))
+    return nullptr;
+  return compiled;
+}
+
+/**
+ * Append the instructions testing a rule, and the rules below it. The operands of a rule are appended last first, so
+ * the instructions they go to already exist.
+ * @param rule :: the rule to append
+ * @param onTrue :: where to go when the rule is valid
+ * @param onFalse :: where to go when the rule is not valid
+ * @param entry :: on exit where to start the test of the rule
+ * @return false if the rule cannot be compiled
+ */
+bool CompiledRules::append(const Rule *rule, const uint32_t onTrue, const uint32_t onFalse, uint32_t &entry) {
+  if (const auto *intersection = dynamic_cast<const Intersection *>(rule)) {
+    const Rule *a = intersection->leaf(0);
+    const Rule *b = intersection->leaf(1);
+    if (!a || !b) {
+      entry = onFalse;
+      return true;
+    }
+    uint32_t second(0);
+    return append(b, onTrue, onFalse, second) && append(a, second, onFalse, entry);
+  } else if (const auto *unionRule = dynamic_cast<const Union *>(rule)) {
+    const Rule *a = unionRule->leaf(0);
+    const Rule *b = unionRule->leaf(1);
+    if (!a && !b) {
+      entry = onFalse;
+      return true;
+    }
+    if (!a || !b)
+      return append(a ? a : b, onTrue, onFalse, entry);
+    uint32_t second(0);
+    return append(b, onTrue, onFalse, second) && append(a, onTrue, second, entry);
+  } else if (const auto *surfPoint = dynamic_cast<const SurfPoint *>(rule)) {
+    const Surface *surface = surfPoint->getKey();
+    if (!surface) {
+      entry = onFalse;
+      return true;
+    }
+    Instruction test = surfaceTest(surface, surfPoint->getSign());
+    test.onTrue = onTrue;
+    test.onFalse = onFalse;
+    entry = static_cast<uint32_t>(m_program.size());
+    m_program.emplace_back(test);
+  } else if (const auto *compGrp = dynamic_cast<const CompGrp *>(rule)) {
+    const Rule *leaf = compGrp->leaf(0);
+    if (!leaf) {
+      entry = onTrue;
+      return true;
+    }
+    return append(leaf, onFalse, onTrue, entry);
+  } else if (const auto *compObj = dynamic_cast<const CompObj *>(rule)) {
+    if (!compObj->getObj()) {
+      entry = onTrue;
+      return true;
+    }
+    entry = static_cast<uint32_t>(m_program.size());
+    m_program.push_back({OpCode::ComplementObject, 0, 0, static_cast<uint32_t>(m_objects.size()), onTrue, onFalse});
+    m_objects.emplace_back(compObj->getObj());
+  } else if (const auto *boolValue = dynamic_cast<const BoolValue *>(rule)) {
+    entry = boolValue->isValid(Kernel::V3D()) ? onTrue : onFalse;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Create the test of a side of a surface, copying the coefficients of the surface the first time it is seen
+ * @param surface :: the surface
+ * @param sign :: the side of the surface which is valid, as given by SurfPoint::getSign
+ * @return the instruction testing the side
+ */
+CompiledRules::Instruction CompiledRules::surfaceTest(const Surface *surface, const int sign) {
+  const auto known = std::find_if(m_surfaces.cbegin(), m_surfaces.cend(),
+                                  [surface](const auto &entry) { return entry.first == surface; });
+  if (known != m_surfaces.cend()) {
+    Instruction test = known->second;
+    test.sign = static_cast<int16_t>(sign);
+    return test;
+  }
+
+  Instruction test{OpCode::Surface, 0, static_cast<int16_t>(sign), static_cast<uint32_t>(m_coefficients.size()), 0, 0};
+  // only the exact classes are copied, as a derived class may define its own side
+  const auto &type = typeid(*surface);
+  if (type == typeid(Plane)) {
+    const auto &plane = static_cast<const Plane &>(*surface);
+    const auto &normal = plane.getNormal();
+    test.op = OpCode::Plane;
+    m_coefficients.insert(m_coefficients.end(), {normal.X(), normal.Y(), normal.Z(), plane.getDistance()});
+  } else if (type == typeid(Sphere)) {
+    const auto &sphere = static_cast<const Sphere &>(*surface);
+    const auto centre = sphere.getCentre();
+    test.op = OpCode::Sphere;
+    m_coefficients.insert(m_coefficients.end(), {centre.X(), centre.Y(), centre.Z(), sphere.getRadius()});
+  } else if (type == typeid(Cylinder) && static_cast<const Cylinder &>(*surface).getNormVec() > 0) {
+    const auto &cylinder = static_cast<const Cylinder &>(*surface);
+    const auto centre = cylinder.getCentre();
+    test.op = OpCode::AxisCylinder;
+    test.axis = static_cast<uint8_t>(cylinder.getNormVec());
+    m_coefficients.insert(m_coefficients.end(),
+                          {centre.X(), centre.Y(), centre.Z(), cylinder.getRadius(), 1. / cylinder.getRadius()});
+  } else if (type == typeid(Cylinder) || type == typeid(General)) {
+    test.op = OpCode::Quadric;
+    const auto &equation = static_cast<const Quadratic &>(*surface).copyBaseEqn();
+    m_coefficients.insert(m_coefficients.end(), equation.cbegin(), equation.cend());
+  } else {
+    // the surface is asked through Surface::side
+    test.index = static_cast<uint32_t>(m_surfaces.size());
+  }
+  m_surfaces.emplace_back(surface, test);
+  return test;
+}
+
+/**
+ * Determine whether a point is inside the object or on its surface, as Rule::isValid does
+ * @param point :: the point to test
+ * @return true if the point is valid
+ */
+bool CompiledRules::isValid(const Kernel::V3D &point) const {
+  const double x = point.X();
+  const double y = point.Y();
+  const double z = point.Z();
+  uint32_t next = m_entry;
+  while (next < INVALID) {
+    const Instruction &instruction = m_program[next];
+    const double *c = m_coefficients.data() + instruction.index;
+    int side(0);
+    switch (instruction.op) {
+    case OpCode::Plane: {
+      const double distance = c[0] * x + c[1] * y + c[2] * z - c[3];
+      // Plane::side treats a distance of exactly the tolerance as on the surface
+      if (Tolerance < std::abs(distance))
+        side = (distance > 0) ? 1 : -1;
+      break;
+    }
+    case OpCode::Sphere: {
+      const double dx(x - c[0]), dy(y - c[1]), dz(z - c[2]);
+      side = sideOf(std::sqrt(dx * dx + dy * dy + dz * dz) - c[3]);
+      break;
+    }
+    case OpCode::AxisCylinder: {
+      // Cylinder::side puts every point inside a cylinder without a radius
+      side = -1;
+      if (c[3] > 0.0) {
+        const double a = point[instruction.axis % 3] - c[instruction.axis % 3];
+        const double b = point[(instruction.axis + 1) % 3] - c[(instruction.axis + 1) % 3];
+        side = sideOf((a * a + b * b - c[3] * c[3]) * c[4]);
+      }
+      break;
+    }
+    case OpCode::Quadric:
+      side = sideOf(c[0] * x * x + c[1] * y * y + c[2] * z * z + c[3] * x * y + c[4] * x * z + c[5] * y * z +
+                    c[6] * x + c[7] * y + c[8] * z + c[9]);
+      break;
+    case OpCode::Surface:
+      side = m_surfaces[instruction.index].first->side(point);
+      break;
+    case OpCode::ComplementObject:
+      next = m_objects[instruction.index]->isValid(point) ? instruction.onFalse : instruction.onTrue;
+      continue;
+    }
+    next = side * instruction.sign >= 0 ? instruction.onTrue : instruction.onFalse;
+  }
+  return next == VALID;
+}
+
+} // namespace Mantid::Geometry
@@ -0,0 +1,182 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Objects/MeshBoundingVolumeHierarchy.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+namespace Mantid::Geometry {
+
+namespace {
+/// The largest number of triangles held by a leaf
+constexpr uint32_t MAX_LEAF_SIZE{4};
+/// The padding of the boxes relative to the size of the mesh
+constexpr double RELATIVE_PADDING{1e-6};
+/// Deeper than any tree built by median splits of 2^32 triangles
+constexpr size_t MAX_DEPTH{64};
+} // namespace
+
+/**
+ * Build the tree over the triangles of a mesh
+ * @param triangles :: the vertex indices of the triangles, three per triangle
+ * @param vertices :: the vertices of the mesh
+ */
+MeshBoundingVolumeHierarchy::MeshBoundingVolumeHierarchy(const std::vector<uint32_t> &triangles,
+                                                         const std::vector<Kernel::V3D> &vertices) {
+  const auto numberOfTriangles = static_cast<uint32_t>(triangles.size() / 3);
+  if (numberOfTriangles == 0)
+    return;
+
+  std::vector<Node> triangleBoxes(numberOfTriangles);
+  std::vector<std::array<double, 3>> centroids(numberOfTriangles);
+  std::array<double, 3> meshMin, meshMax;
+  meshMin.fill(std::numeric_limits<double>::max());
+  meshMax.fill(std::numeric_limits<double>::lowest());
+  for (uint32_t i = 0; i < numberOfTriangles; ++i) {
+    const auto &v1 = vertices[triangles[3 * i]];
+    const auto &v2 = vertices[triangles[3 * i + 1]];
+    const auto &v3 = vertices[triangles[3 * i + 2]];
+    for (size_t axis = 0; axis < 3; ++axis) {
+      triangleBoxes[i].min[axis] = std::min({v1[axis], v2[axis], v3[axis]});
+      triangleBoxes[i].max[axis] = std::max({v1[axis], v2[axis], v3[axis]});
+      centroids[i][axis] = (v1[axis] + v2[axis] + v3[axis]) / 3.0;
+      meshMin[axis] = std::min(meshMin[axis], triangleBoxes[i].min[axis]);
+      meshMax[axis] = std::max(meshMax[axis], triangleBoxes[i].max[axis]);
+    }
+  }
+
+  // pad every box so that flat triangles and rays grazing an edge still hit
+  const Kernel::V3D meshSize(meshMax[0] - meshMin[0], meshMax[1] - meshMin[1], meshMax[2] - meshMin[2]);
+  const double padding = RELATIVE_PADDING * meshSize.norm() + std::numeric_limits<double>::min();
+  for (auto &box : triangleBoxes) {
+    for (size_t axis = 0; axis < 3; ++axis) {
+      box.min[axis] -= padding;
+      box.max[axis] += padding;
+    }
+  }
+
+  m_triangleOrder.resize(numberOfTriangles);
+  std::iota(m_triangleOrder.begin(), m_triangleOrder.end(), 0);
+  m_nodes.reserve(2 * (numberOfTriangles / MAX_LEAF_SIZE) + 1);
+  build(centroids, triangleBoxes, 0, numberOfTriangles);
+}
+
+/**
+ * Add the node holding a range of m_triangleOrder, and the nodes below it, to the tree
+ * @param centroids :: the centroid of every triangle
+ * @param triangleBoxes :: the padded box around every triangle
+ * @param begin :: the first entry of m_triangleOrder held by the node
+ * @param end :: one past the last entry of m_triangleOrder held by the node
+ * @return the index of the node added
+ */
+uint32_t MeshBoundingVolumeHierarchy::build(const std::vector<std::array<double, 3>> &centroids,
+                                            const std::vector<Node> &triangleBoxes, const uint32_t begin,
+                                            const uint32_t end) {
+  Node node;
+  node.min.fill(std::numeric_limits<double>::max());
+  node.max.fill(std::numeric_limits<double>::lowest());
+  std::array<double, 3> centroidMin, centroidMax;
+  centroidMin.fill(std::numeric_limits<double>::max());
+  centroidMax.fill(std::numeric_limits<double>::lowest());
+  for (uint32_t i = begin; i < end; ++i) {
+    const auto triangle = m_triangleOrder[i];
+    for (size_t axis = 0; axis < 3; ++axis) {
+      node.min[axis] = std::min(node.min[axis], triangleBoxes[triangle].min[axis]);
+      node.max[axis] = std::max(node.max[axis], triangleBoxes[triangle].max[axis]);
+      centroidMin[axis] = std::min(centroidMin[axis], centroids[triangle][axis]);
+      centroidMax[axis] = std::max(centroidMax[axis], centroids[triangle][axis]);
+    }
+  }
+
+  const auto nodeIndex = static_cast<uint32_t>(m_nodes.size());
+  node.offset = begin;
+  node.count = end - begin;
+  m_nodes.emplace_back(node);
+
+  size_t axis = 0;
+  for (size_t i = 1; i < 3; ++i) {
+    if (centroidMax[i] - centroidMin[i] > centroidMax[axis] - centroidMin[axis])
+      axis = i;
+  }
+  // triangles sharing one centroid cannot be split any further
+  if (end - begin <= MAX_LEAF_SIZE || centroidMax[axis] == centroidMin[axis])
+    return nodeIndex;
+
+  const uint32_t middle = begin + (end - begin) / 2;
+  const auto byCentroid = [&centroids, axis](const uint32_t a, const uint32_t b) {
+    return centroids[a][axis] < centroids[b][axis];
+  };
+  std::nth_element(m_triangleOrder.begin() + begin, m_triangleOrder.begin() + middle, m_triangleOrder.begin() + end,
+                   byCentroid);
+  build(centroids, triangleBoxes, begin, middle);
+  const auto secondChild = build(centroids, triangleBoxes, middle, end);
+  m_nodes[nodeIndex].offset = secondChild;
+  m_nodes[nodeIndex].count = 0;
+  return nodeIndex;
+}
+
+/**
+ * Find the triangles whose boxes are crossed by a ray. Only these triangles can intersect the ray.
+ * @param start :: the start point of the ray
+ * @param direction :: the direction of the ray
+ * @param candidates :: on exit the indices of the triangles, in ascending order
+ */
+void MeshBoundingVolumeHierarchy::getCandidateTriangles(const Kernel::V3D &start, const Kernel::V3D &direction,
+                                                        std::vector<size_t> &candidates) const {
+  candidates.clear();
+  if (m_nodes.empty())
+    return;
+
+  std::array<double, 3> inverseDirection;
+  for (size_t axis = 0; axis < 3; ++axis)
+    inverseDirection[axis] = direction[axis] != 0. ? 1. / direction[axis] : 0.;
+
+  // slab test of the ray against a box
+  const auto crossesBox = [&start, &direction, &inverseDirection](const Node &node) {
+    double tEnter = 0.;
+    double tExit = std::numeric_limits<double>::max();
+    for (size_t axis = 0; axis < 3; ++axis) {
+      if (direction[axis] == 0.) {
+        if (start[axis] < node.min[axis] || start[axis] > node.max[axis])
+          return false;
+        continue;
+      }
+      double t1 = (node.min[axis] - start[axis]) * inverseDirection[axis];
+      double t2 = (node.max[axis] - start[axis]) * inverseDirection[axis];
+      if (t1 > t2)
+        std::swap(t1, t2);
+      tEnter = std::max(tEnter, t1);
+      tExit = std::min(tExit, t2);
+      if (tEnter > tExit)
+        return false;
+    }
+    return true;
+  };
+
+  std::array<uint32_t, MAX_DEPTH> stack;
+  size_t stackSize = 0;
+  stack[stackSize++] = 0;
+  while (stackSize > 0) {
+    const Node &node = m_nodes[stack[--stackSize]];
+    if (!crossesBox(node))
+      continue;
+    if (node.count > 0) {
+      candidates.insert(candidates.end(), m_triangleOrder.begin() + node.offset,
+                        m_triangleOrder.begin() + node.offset + node.count);
+    } else {
+      const auto firstChild = static_cast<uint32_t>(&node - m_nodes.data()) + 1;
+      stack[stackSize++] = node.offset;
+      stack[stackSize++] = firstChild;
+    }
+  }
+  // callers visit the triangles in the order of the mesh, as they would without the tree
+  std::sort(candidates.begin(), candidates.end());
+}
+
+} // namespace Mantid::Geometry
@@ -40,6 +40,7 @@ MeshObject::MeshObject(std::vector<uint32_t> &&faces, std::vector<Kernel::V3D> &
 void MeshObject::initialize() {
 
   MeshObjectCommon::checkVertexLimit(m_vertices.size());
+  m_hierarchy = MeshBoundingVolumeHierarchy(m_triangles, m_vertices);
   m_handler = std::make_shared<GeometryHandler>(*this);
 }
 
@@ -177,7 +178,11 @@ int MeshObject::interceptSurface(Geometry::Track &UT) const {
 double MeshObject::distance(const Track &track) const {
   Kernel::V3D vertex1, vertex2, vertex3, intersection;
   TrackDirection unused;
-  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+  std::vector<size_t> candidates;
+  // only the triangles whose bounding boxes the ray crosses can intersect it
+  m_hierarchy.getCandidateTriangles(track.startPoint(), track.direction(), candidates);
+  for (const auto i : candidates) {
+    getTriangle(i, vertex1, vertex2, vertex3);
     if (MeshObjectCommon::rayIntersectsTriangle(track.startPoint(), track.direction(), vertex1, vertex2, vertex3,
                                                 intersection, unused)) {
       return track.startPoint().distance(intersection);
@@ -202,7 +207,11 @@ void MeshObject::getIntersections(const Kernel::V3D &start, const Kernel::V3D &d
 
   Kernel::V3D vertex1, vertex2, vertex3, intersection;
   TrackDirection entryExit;
-  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+  std::vector<size_t> candidates;
+  // only the triangles whose bounding boxes the ray crosses can intersect it
+  m_hierarchy.getCandidateTriangles(start, direction, candidates);
+  for (const auto i : candidates) {
+    getTriangle(i, vertex1, vertex2, vertex3);
     if (MeshObjectCommon::rayIntersectsTriangle(start, direction, vertex1, vertex2, vertex3, intersection, entryExit)) {
       intersectionPoints.emplace_back(intersection);
       entryExitFlags.emplace_back(entryExit);
@@ -477,6 +486,7 @@ std::shared_ptr<GeometryHandler> MeshObject::getGeometryHandler() const {
 void MeshObject::rotate(const Kernel::Matrix<double> &rotationMatrix) {
   std::for_each(m_vertices.begin(), m_vertices.end(),
                 [&rotationMatrix](auto &vertex) { vertex.rotate(rotationMatrix); });
+  m_hierarchy = MeshBoundingVolumeHierarchy(m_triangles, m_vertices);
 }
 
 /**
@@ -486,6 +496,7 @@ void MeshObject::rotate(const Kernel::Matrix<double> &rotationMatrix) {
 void MeshObject::translate(const Kernel::V3D &translationVector) {
   std::transform(m_vertices.cbegin(), m_vertices.cend(), m_vertices.begin(),
                  [&translationVector](const auto &vertex) { return vertex + translationVector; });
+  m_hierarchy = MeshBoundingVolumeHierarchy(m_triangles, m_vertices);
 }
 
 /**
@@ -495,6 +506,7 @@ void MeshObject::translate(const Kernel::V3D &translationVector) {
 void MeshObject::scale(const double scaleFactor) {
   std::transform(m_vertices.cbegin(), m_vertices.cend(), m_vertices.begin(),
                  [&scaleFactor](const auto &vertex) { return vertex * scaleFactor; });
+  m_hierarchy = MeshBoundingVolumeHierarchy(m_triangles, m_vertices);
 }
 
 /**
@@ -520,6 +532,7 @@ void MeshObject::multiply(const Kernel::Matrix<double> &matrix) {
     Kernel::V3D newvertex(vertexout[0], vertexout[1], vertexout[2]);
     vertex = newvertex;
   }
+  m_hierarchy = MeshBoundingVolumeHierarchy(m_triangles, m_vertices);
 }
 
 /**
@@ -283,4 +283,22 @@ double Track::calculateAttenuation(double lambda) const {
   return factor;
 }
 
+/**
+ * Add the attenuation coefficient times the distance inside the object, summed over all links, for a set of
+ * wavelengths. The attenuation at a wavelength is the exponential of minus this exponent, so a caller combining
+ * several tracks needs one exponential for every wavelength rather than one for every link.
+ * @param lambdas The wavelengths (Angstroms)
+ * @param exponents The exponents to add to, one for every wavelength
+ */
+void Track::addAttenuationExponents(const std::vector<double> &lambdas, std::vector<double> &exponents) const {
+  const size_t nLambdas = lambdas.size();
+  for (const auto &segment : m_links) {
+    const double length = segment.distInsideObject;
+    const auto &material = segment.object->material();
+    for (size_t i = 0; i < nLambdas; ++i) {
+      exponents[i] += material.attenuationCoefficient(lambdas[i]) * length;
+    }
+  }
+}
+
 } // namespace Mantid::Geometry
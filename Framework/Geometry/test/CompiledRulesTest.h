@@ -0,0 +1,126 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidFrameworkTestHelpers/ComponentCreationHelper.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/CompiledRules.h"
+#include "MantidGeometry/Objects/Rules.h"
+#include "MantidGeometry/Objects/ShapeFactory.h"
+#include "MantidKernel/V3D.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <random>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::V3D;
+
+class CompiledRulesTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static CompiledRulesTest *createSuite() { return new CompiledRulesTest(); }
+  static void destroySuite(CompiledRulesTest *suite) { delete suite; }
+
+  void test_no_rule_does_not_compile() { TS_ASSERT(!CompiledRules::compile(nullptr)); }
+
+  void test_sphere() {
+    auto sphere = ComponentCreationHelper::createSphere(0.5, V3D(0.1, 0.2, 0.3));
+    checkMatchesRules(*sphere, 1);
+    // points on the surface are valid
+    auto compiled = CompiledRules::compile(sphere->topRule());
+    TS_ASSERT(compiled->isValid(V3D(0.6, 0.2, 0.3)));
+    TS_ASSERT(!compiled->isValid(V3D(0.61, 0.2, 0.3)));
+  }
+
+  void test_hollow_shell() {
+    auto shell = ComponentCreationHelper::createHollowShell(0.5, 1.0);
+    checkMatchesRules(*shell, 2);
+  }
+
+  void test_cuboid() {
+    auto cuboid = ComponentCreationHelper::createCuboid(0.5, 0.3, 0.2);
+    checkMatchesRules(*cuboid, 6);
+    auto compiled = CompiledRules::compile(cuboid->topRule());
+    TS_ASSERT(compiled->isValid(V3D(0.5, 0.3, 0.2)));
+    TS_ASSERT(!compiled->isValid(V3D(0.51, 0.3, 0.2)));
+  }
+
+  void test_cylinder_along_an_axis() {
+    auto cylinder = ComponentCreationHelper::createCappedCylinder(0.4, 1.2, V3D(0.1, -0.6, 0.0), V3D(0, 1, 0), "cyl");
+    checkMatchesRules(*cylinder, 3);
+  }
+
+  void test_tilted_cylinder() {
+    auto cylinder = ComponentCreationHelper::createCappedCylinder(0.4, 1.2, V3D(-0.3, -0.3, -0.3), V3D(1, 1, 1), "cyl");
+    checkMatchesRules(*cylinder, 3);
+  }
+
+  void test_cone_uses_the_surface() {
+    std::string xmlShape = "<cone id=\"shape\"> ";
+    xmlShape += R"(<tip-point x="0.0" y="0.0" z="1.0" /> )";
+    xmlShape += R"(<axis x="0.0" y="0.0" z="-1" /> )";
+    xmlShape += "<angle val=\"30\" /> ";
+    xmlShape += "<height val=\"2\" /> ";
+    xmlShape += "</cone>";
+    xmlShape += "<algebra val=\"shape\" /> ";
+    auto cone = ShapeFactory().createShape(xmlShape);
+    checkMatchesRules(*cone, 2);
+  }
+
+  void test_union_and_complement() {
+    std::string xmlShape = R"(<sphere id="ball"> <centre x="0.0" y="0.0" z="0.0" /> <radius val="0.6" /> </sphere>)";
+    xmlShape += R"(<cuboid id="box"> <left-front-bottom-point x="-0.9" y="-0.2" z="-0.2" />)";
+    xmlShape += R"(<left-front-top-point x="-0.9" y="-0.2" z="0.2" />)";
+    xmlShape += R"(<left-back-bottom-point x="-0.9" y="0.2" z="-0.2" />)";
+    xmlShape += R"(<right-front-bottom-point x="0.9" y="-0.2" z="-0.2" /> </cuboid>)";
+    xmlShape += R"(<sphere id="hole"> <centre x="0.0" y="0.0" z="0.0" /> <radius val="0.1" /> </sphere>)";
+    xmlShape += R"(<algebra val="(ball : box) # hole" /> )";
+    auto shape = ShapeFactory().createShape(xmlShape);
+    checkMatchesRules(*shape, 8);
+    TS_ASSERT(!shape->isValid(V3D(0, 0, 0)));
+    TS_ASSERT(shape->isValid(V3D(0.8, 0, 0)));
+  }
+
+  void test_copied_object_is_compiled_against_its_own_surfaces() {
+    auto sphere = ComponentCreationHelper::createSphere(0.5);
+    CSGObject copy(*sphere);
+    sphere.reset();
+    TS_ASSERT(copy.isValid(V3D(0.4, 0, 0)));
+    TS_ASSERT(!copy.isValid(V3D(0.6, 0, 0)));
+  }
+
+private:
+  /// Check the compiled rules agree with the rule tree for points in and around the bounding box of the object
+  void checkMatchesRules(const CSGObject &object, const size_t numberOfSurfaces) {
+    auto compiled = CompiledRules::compile(object.topRule());
+    TS_ASSERT(compiled);
+    if (!compiled)
+      return;
+    TS_ASSERT_EQUALS(compiled->numberOfSurfaces(), numberOfSurfaces);
+
+    const auto &box = object.getBoundingBox();
+    const V3D margin = (box.maxPoint() - box.minPoint()) * 0.1;
+    const V3D minPoint = box.minPoint() - margin;
+    const V3D maxPoint = box.maxPoint() + margin;
+    std::mt19937 generator(13);
+    std::uniform_real_distribution<double> fraction(0., 1.);
+    size_t numberValid(0);
+    for (size_t i = 0; i < 5000; ++i) {
+      V3D point;
+      for (size_t axis = 0; axis < 3; ++axis)
+        point[axis] = minPoint[axis] + fraction(generator) * (maxPoint[axis] - minPoint[axis]);
+      const bool expected = object.topRule()->isValid(point);
+      TS_ASSERT_EQUALS(compiled->isValid(point), expected);
+      TS_ASSERT_EQUALS(object.isValid(point), expected);
+      if (expected)
+        ++numberValid;
+    }
+    TS_ASSERT_LESS_THAN(0, numberValid);
+  }
+};
@@ -0,0 +1,129 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidFrameworkTestHelpers/ComponentCreationHelper.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorBoundingVolumeHierarchy.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/InstrumentVisitor.h"
+#include "MantidGeometry/Objects/InstrumentRayTracer.h"
+#include "MantidKernel/V3D.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <random>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::V3D;
+
+class DetectorBoundingVolumeHierarchyTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static DetectorBoundingVolumeHierarchyTest *createSuite() { return new DetectorBoundingVolumeHierarchyTest(); }
+  static void destroySuite(DetectorBoundingVolumeHierarchyTest *suite) { delete suite; }
+
+  void test_every_detector_of_a_cylindrical_instrument_is_found() {
+    auto instrument = createCylindricalInstrument();
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    const auto &detectorInfo = *wrappers.second;
+    DetectorBoundingVolumeHierarchy hierarchy(*wrappers.first, detectorInfo);
+    TS_ASSERT_EQUALS(hierarchy.numberOfTargets(), detectorInfo.size());
+
+    for (size_t index = 0; index < detectorInfo.size(); ++index) {
+      const auto detector = hierarchy.findDetector(detectorInfo.samplePosition(),
+                                                   detectorInfo.position(index) - detectorInfo.samplePosition());
+      TS_ASSERT(detector);
+      if (detector)
+        TS_ASSERT_EQUALS(*detector, index);
+    }
+  }
+
+  void test_every_pixel_of_a_rectangular_bank_is_found() {
+    auto instrument = ComponentCreationHelper::createTestInstrumentRectangular2(1, 20);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    const auto &detectorInfo = *wrappers.second;
+    DetectorBoundingVolumeHierarchy hierarchy(*wrappers.first, detectorInfo);
+    // the bank is one target
+    TS_ASSERT_EQUALS(hierarchy.numberOfTargets(), 1);
+
+    for (size_t index = 0; index < detectorInfo.size(); ++index) {
+      const auto detector = hierarchy.findDetector(detectorInfo.samplePosition(),
+                                                   detectorInfo.position(index) - detectorInfo.samplePosition());
+      TS_ASSERT(detector);
+      if (detector)
+        TS_ASSERT_EQUALS(*detector, index);
+    }
+  }
+
+  void test_rays_missing_the_detectors_find_nothing() {
+    auto instrument = ComponentCreationHelper::createTestInstrumentRectangular2(1, 20);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    const auto &detectorInfo = *wrappers.second;
+    DetectorBoundingVolumeHierarchy hierarchy(*wrappers.first, detectorInfo);
+    const auto bankDirection = detectorInfo.position(0) - detectorInfo.samplePosition();
+
+    TS_ASSERT(!hierarchy.findDetector(detectorInfo.samplePosition(), bankDirection * -1.0));
+    TS_ASSERT(!hierarchy.findDetector(detectorInfo.samplePosition(), V3D(0, 0, 0)));
+  }
+
+  void test_matches_the_instrument_ray_tracer() {
+    checkMatchesRayTracer(createCylindricalInstrument(), 0.05);
+    checkMatchesRayTracer(ComponentCreationHelper::createTestInstrumentRectangular2(2, 20), 0.02);
+  }
+
+  void test_batch_query_matches_single_queries() {
+    auto instrument = createCylindricalInstrument();
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    const auto &detectorInfo = *wrappers.second;
+    DetectorBoundingVolumeHierarchy hierarchy(*wrappers.first, detectorInfo);
+
+    std::vector<V3D> directions;
+    for (size_t index = 0; index < detectorInfo.size(); ++index) {
+      directions.emplace_back(detectorInfo.position(index));
+      directions.emplace_back(detectorInfo.position(index) * -1.0);
+    }
+    const auto detectors = hierarchy.findDetectors(detectorInfo.samplePosition(), directions);
+    TS_ASSERT_EQUALS(detectors.size(), directions.size());
+    for (size_t i = 0; i < directions.size(); ++i) {
+      TS_ASSERT_EQUALS(detectors[i], hierarchy.findDetector(detectorInfo.samplePosition(), directions[i]));
+    }
+  }
+
+private:
+  /// Three banks of nine large cylindrical pixels around the sample
+  Instrument_sptr createCylindricalInstrument() {
+    return ComponentCreationHelper::createTestInstrumentCylindrical(3, V3D(0, 0, -1), V3D(0, 0, 0), 1.6, 1.0);
+  }
+
+  /// Check the detectors hit by rays around each detector are those found by tracing the component tree
+  void checkMatchesRayTracer(const Instrument_sptr &instrument, const double spread) {
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    const auto &detectorInfo = *wrappers.second;
+    DetectorBoundingVolumeHierarchy hierarchy(*wrappers.first, detectorInfo);
+    InstrumentRayTracer tracer(instrument);
+
+    std::mt19937 generator(5);
+    std::uniform_real_distribution<double> offset(-spread, spread);
+    size_t numberOfHits(0);
+    for (size_t index = 0; index < detectorInfo.size(); ++index) {
+      const V3D direction = normalize(detectorInfo.position(index) - detectorInfo.samplePosition() +
+                                      V3D(offset(generator), offset(generator), offset(generator)));
+      tracer.traceFromSample(direction);
+      const auto traced = tracer.getDetectorResult();
+      const auto detector = hierarchy.findDetector(detectorInfo.samplePosition(), direction);
+      TS_ASSERT_EQUALS(detector.has_value(), static_cast<bool>(traced));
+      if (detector && traced) {
+        TS_ASSERT_EQUALS(*detector, detectorInfo.indexOf(traced->getID()));
+        ++numberOfHits;
+      }
+    }
+    TS_ASSERT_LESS_THAN(0, numberOfHits);
+  }
+};
@@ -0,0 +1,312 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/InstrumentCache.h"
+#include "MantidGeometry/Instrument/InstrumentDefinitionParser.h"
+#include "MantidGeometry/Instrument/InstrumentVisitor.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Instrument/XMLInstrumentParameter.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidKernel/BinaryStreamWriter.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Strings.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::ConfigService;
+
+class InstrumentCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static InstrumentCacheTest *createSuite() { return new InstrumentCacheTest(); }
+  static void destroySuite(InstrumentCacheTest *suite) { delete suite; }
+
+  InstrumentCacheTest()
+      : m_cacheFile((std::filesystem::path(ConfigService::Instance().getTempDir()) / "InstrumentCacheTest.instrument")
+                        .string()) {}
+
+  void tearDown() override { std::filesystem::remove(m_cacheFile); }
+
+  void test_instrument_with_parameters_is_read_back() {
+    std::string mangledName;
+    const auto instrument = parse("IDF_for_UNIT_TESTING2.xml", mangledName);
+    TS_ASSERT(!instrument->getLogfileCache().empty());
+    TS_ASSERT(InstrumentCache::write(*instrument, m_cacheFile, mangledName));
+
+    const auto cached = InstrumentCache::read(m_cacheFile, mangledName);
+    TS_ASSERT(cached);
+    if (cached)
+      checkSameInstrument(*instrument, *cached);
+  }
+
+  void test_rectangular_detectors_are_read_back() {
+    std::string mangledName;
+    const auto instrument = parse("IDF_for_RECTANGULAR_UNIT_TESTING.xml", mangledName);
+    TS_ASSERT(InstrumentCache::write(*instrument, m_cacheFile, mangledName));
+
+    const auto cached = InstrumentCache::read(m_cacheFile, mangledName);
+    TS_ASSERT(cached);
+    if (cached) {
+      checkSameInstrument(*instrument, *cached);
+      TS_ASSERT_EQUALS(cached->findRectDetectors().size(), instrument->findRectDetectors().size());
+    }
+  }
+
+  void test_assemblies_with_outlines_are_read_back() {
+    std::string mangledName;
+    const auto instrument = parse("MAPS_Definition_Reduced.xml", mangledName);
+    TS_ASSERT(InstrumentCache::write(*instrument, m_cacheFile, mangledName));
+
+    const auto cached = InstrumentCache::read(m_cacheFile, mangledName);
+    TS_ASSERT(cached);
+    if (cached)
+      checkSameInstrument(*instrument, *cached);
+  }
+
+  void test_shapes_shared_by_detectors_stay_shared() {
+    std::string mangledName;
+    const auto instrument = parse("IDF_for_UNIT_TESTING.xml", mangledName);
+    TS_ASSERT(InstrumentCache::write(*instrument, m_cacheFile, mangledName));
+    const auto cached = InstrumentCache::read(m_cacheFile, mangledName);
+    TS_ASSERT(cached);
+    if (!cached)
+      return;
+
+    const auto numberOfShapes = countShapes(*instrument);
+    TS_ASSERT_LESS_THAN(numberOfShapes, InstrumentVisitor::makeWrappers(*instrument).second->size());
+    TS_ASSERT_EQUALS(countShapes(*cached), numberOfShapes);
+  }
+
+  void test_file_for_another_definition_is_not_read() {
+    std::string mangledName;
+    const auto instrument = parse("IDF_for_UNIT_TESTING.xml", mangledName);
+    TS_ASSERT(InstrumentCache::write(*instrument, m_cacheFile, mangledName));
+
+    TS_ASSERT(!InstrumentCache::read(m_cacheFile, mangledName + "changed"));
+  }
+
+  void test_incomplete_file_is_not_read() {
+    std::string mangledName;
+    const auto instrument = parse("IDF_for_UNIT_TESTING.xml", mangledName);
+    TS_ASSERT(InstrumentCache::write(*instrument, m_cacheFile, mangledName));
+    std::filesystem::resize_file(m_cacheFile, std::filesystem::file_size(m_cacheFile) / 2);
+
+    TS_ASSERT(!InstrumentCache::read(m_cacheFile, mangledName));
+  }
+
+  void test_instrument_with_physical_instrument_is_not_written() {
+    std::string mangledName;
+    const auto instrument = parse("INDIRECT_Definition.xml", mangledName);
+    TS_ASSERT(instrument->getPhysicalInstrument());
+
+    TS_ASSERT(!InstrumentCache::write(*instrument, m_cacheFile, mangledName));
+    TS_ASSERT(!std::filesystem::exists(m_cacheFile));
+  }
+
+  void test_instrument_is_saved_in_and_loaded_from_the_cache_directory() {
+    const auto geometryCache = useGeometryCacheDirectory();
+
+    std::string mangledName;
+    const auto instrument = parse("IDF_for_UNIT_TESTING.xml", mangledName);
+    TS_ASSERT(!InstrumentCache::load(mangledName));
+    TS_ASSERT(InstrumentCache::save(*instrument, mangledName));
+    const auto cached = InstrumentCache::load(mangledName);
+    TS_ASSERT(cached);
+    if (cached)
+      checkSameInstrument(*instrument, *cached);
+
+#ifndef _WIN32
+    // files in a directory other users can write to are not trusted
+    std::filesystem::permissions(geometryCache / "instruments", std::filesystem::perms::group_write,
+                                 std::filesystem::perm_options::add);
+    TS_ASSERT(!InstrumentCache::load(mangledName));
+    TS_ASSERT(!InstrumentCache::save(*instrument, mangledName));
+#endif
+
+    restoreGeometryCacheDirectory(geometryCache);
+  }
+
+  void test_save_removes_files_written_by_other_builds() {
+    const auto geometryCache = useGeometryCacheDirectory();
+    std::string mangledName;
+    const auto instrument = parse("IDF_for_UNIT_TESTING.xml", mangledName);
+    const auto directory = geometryCache / "instruments";
+    std::filesystem::create_directories(directory);
+
+    // another definition saved by this build is kept
+    const auto otherDefinition = directory / "OtherDefinition.instrument";
+    TS_ASSERT(InstrumentCache::write(*instrument, otherDefinition.string(), "OtherDefinition"));
+    // files of another build or another layout, and files too short to have been written by this build, are removed
+    const auto otherBuild = directory / "OtherBuild.instrument";
+    writeHeader(otherBuild, InstrumentCache::FORMAT_VERSION, "0.0.0 0000000");
+    const auto otherLayout = directory / "OtherLayout.instrument";
+    writeHeader(otherLayout, InstrumentCache::FORMAT_VERSION - 1, "0.0.0 0000000");
+    const auto truncated = directory / "Truncated.instrument";
+    std::ofstream(truncated, std::ios::binary) << "Mantid";
+    // files of other kinds are left alone
+    const auto notACacheFile = directory / "NotACacheFile.txt";
+    std::ofstream(notACacheFile) << "text";
+
+    TS_ASSERT(InstrumentCache::save(*instrument, mangledName));
+    TS_ASSERT(std::filesystem::exists(directory / (mangledName + ".instrument")));
+    TS_ASSERT(std::filesystem::exists(otherDefinition));
+    TS_ASSERT(!std::filesystem::exists(otherBuild));
+    TS_ASSERT(!std::filesystem::exists(otherLayout));
+    TS_ASSERT(!std::filesystem::exists(truncated));
+    TS_ASSERT(std::filesystem::exists(notACacheFile));
+
+    restoreGeometryCacheDirectory(geometryCache);
+  }
+
+  void test_shapes_loaded_from_the_cache_directory_read_the_geometry_cache_of_the_definition() {
+    const auto geometryCache = useGeometryCacheDirectory();
+    std::string mangledName;
+    const auto instrument = parse("IDF_for_UNIT_TESTING.xml", mangledName, false);
+    TS_ASSERT(std::filesystem::exists(geometryCache / (mangledName + ".vtp")));
+    TS_ASSERT(InstrumentCache::save(*instrument, mangledName));
+
+    const auto cached = InstrumentCache::load(mangledName);
+    TS_ASSERT(cached);
+    if (cached) {
+      const auto wrappers = InstrumentVisitor::makeWrappers(*cached);
+      const auto &componentInfo = *wrappers.first;
+      size_t numberOfShapes(0);
+      for (size_t index = 0; index < componentInfo.size(); ++index) {
+        if (const auto *shape = dynamic_cast<const CSGObject *>(&componentInfo.shape(index));
+            shape && componentInfo.hasValidShape(index)) {
+          TS_ASSERT(shape->getVtkGeometryCacheReader());
+          ++numberOfShapes;
+        }
+      }
+      TS_ASSERT_DIFFERS(numberOfShapes, 0);
+    }
+
+    // without the geometry cache the shapes triangulate themselves
+    std::filesystem::remove(geometryCache / (mangledName + ".vtp"));
+    const auto withoutGeometryCache = InstrumentCache::load(mangledName);
+    TS_ASSERT(withoutGeometryCache);
+    if (withoutGeometryCache) {
+      const auto wrappers = InstrumentVisitor::makeWrappers(*withoutGeometryCache);
+      const auto &componentInfo = *wrappers.first;
+      for (size_t index = 0; index < componentInfo.size(); ++index) {
+        if (const auto *shape = dynamic_cast<const CSGObject *>(&componentInfo.shape(index)))
+          TS_ASSERT(!shape->getVtkGeometryCacheReader());
+      }
+    }
+
+    restoreGeometryCacheDirectory(geometryCache);
+  }
+
+private:
+  /// Use a new geometry cache directory in the temporary directory
+  std::filesystem::path useGeometryCacheDirectory() {
+    auto &config = ConfigService::Instance();
+    m_originalGeometryCache = config.getString("instrumentDefinition.vtp.directory");
+    const auto geometryCache = std::filesystem::path(config.getTempDir()) / "InstrumentCacheTest";
+    std::filesystem::create_directories(geometryCache);
+    config.setString("instrumentDefinition.vtp.directory", geometryCache.string());
+    return geometryCache;
+  }
+
+  /// Remove the geometry cache directory made by useGeometryCacheDirectory and use the original one again
+  void restoreGeometryCacheDirectory(const std::filesystem::path &geometryCache) {
+    ConfigService::Instance().setString("instrumentDefinition.vtp.directory", m_originalGeometryCache);
+    std::filesystem::remove_all(geometryCache);
+  }
+
+  /// Write the start of a cache file as another build would
+  void writeHeader(const std::filesystem::path &filename, const uint32_t formatVersion, const std::string &build) {
+    std::ofstream file(filename, std::ios::binary);
+    Mantid::Kernel::BinaryStreamWriter out(file);
+    out << std::string("MantidInstrumentCache") << formatVersion << build << std::string("Definition");
+  }
+
+  /// Parse a definition from the unit testing directory, removing the vtp file the parser writes unless told not to
+  Instrument_sptr parse(const std::string &definition, std::string &mangledName, const bool removeVTPFile = true) {
+    const std::string filename = ConfigService::Instance().getInstrumentDirectory() + "/unit_testing/" + definition;
+    InstrumentDefinitionParser parser(filename, "For Unit Testing", Mantid::Kernel::Strings::loadFile(filename));
+    auto instrument = parser.parseXML(nullptr);
+    mangledName = parser.getMangledName();
+    if (removeVTPFile)
+      std::filesystem::remove(parser.createVTPFileName());
+    return instrument;
+  }
+
+  void checkSameInstrument(const Instrument &expected, const Instrument &actual) {
+    TS_ASSERT_EQUALS(actual.getName(), expected.getName());
+    TS_ASSERT_EQUALS(actual.getValidFromDate(), expected.getValidFromDate());
+    TS_ASSERT_EQUALS(actual.getDefaultView(), expected.getDefaultView());
+    TS_ASSERT_EQUALS(actual.getReferenceFrame()->pointingUp(), expected.getReferenceFrame()->pointingUp());
+    TS_ASSERT_EQUALS(actual.getReferenceFrame()->pointingAlongBeam(),
+                     expected.getReferenceFrame()->pointingAlongBeam());
+
+    const auto expectedWrappers = InstrumentVisitor::makeWrappers(expected);
+    const auto actualWrappers = InstrumentVisitor::makeWrappers(actual);
+    const auto &expectedComponents = *expectedWrappers.first;
+    const auto &actualComponents = *actualWrappers.first;
+    TS_ASSERT_EQUALS(actualComponents.size(), expectedComponents.size());
+    if (actualComponents.size() != expectedComponents.size())
+      return;
+    for (size_t index = 0; index < expectedComponents.size(); ++index) {
+      TS_ASSERT_EQUALS(actualComponents.name(index), expectedComponents.name(index));
+      TS_ASSERT_EQUALS(actualComponents.position(index), expectedComponents.position(index));
+      TS_ASSERT_EQUALS(actualComponents.rotation(index), expectedComponents.rotation(index));
+      TS_ASSERT_EQUALS(actualComponents.hasValidShape(index), expectedComponents.hasValidShape(index));
+      const auto *expectedShape = dynamic_cast<const CSGObject *>(&expectedComponents.shape(index));
+      const auto *actualShape = dynamic_cast<const CSGObject *>(&actualComponents.shape(index));
+      TS_ASSERT_EQUALS(static_cast<bool>(actualShape), static_cast<bool>(expectedShape));
+      if (expectedShape && actualShape)
+        TS_ASSERT_EQUALS(actualShape->getShapeXML(), expectedShape->getShapeXML());
+    }
+
+    const auto &expectedDetectors = *expectedWrappers.second;
+    const auto &actualDetectors = *actualWrappers.second;
+    TS_ASSERT_EQUALS(actualDetectors.detectorIDs(), expectedDetectors.detectorIDs());
+    for (size_t index = 0; index < expectedDetectors.size(); ++index)
+      TS_ASSERT_EQUALS(actualDetectors.isMonitor(index), expectedDetectors.isMonitor(index));
+    TS_ASSERT_EQUALS(actualDetectors.sourcePosition(), expectedDetectors.sourcePosition());
+    TS_ASSERT_EQUALS(actualDetectors.samplePosition(), expectedDetectors.samplePosition());
+
+    TS_ASSERT_EQUALS(describeParameters(actual), describeParameters(expected));
+  }
+
+  /// The number of distinct shapes of the components
+  size_t countShapes(const Instrument &instrument) {
+    const auto wrappers = InstrumentVisitor::makeWrappers(instrument);
+    const auto &componentInfo = *wrappers.first;
+    std::set<const IObject *> shapes;
+    for (size_t index = 0; index < componentInfo.size(); ++index) {
+      if (componentInfo.hasValidShape(index))
+        shapes.insert(&componentInfo.shape(index));
+    }
+    return shapes.size();
+  }
+
+  /// The parameters given in the definition, which are keyed by component address so cannot be compared in order
+  std::multiset<std::string> describeParameters(const Instrument &instrument) {
+    std::multiset<std::string> descriptions;
+    for (const auto &[key, parameter] : instrument.getLogfileCache()) {
+      descriptions.insert(key.first + ";" + key.second->getFullName() + ";" + parameter->m_component->getFullName() +
+                          ";" + parameter->m_paramName + ";" + parameter->m_value + ";" + parameter->m_type + ";" +
+                          parameter->m_formula + ";" + parameter->m_logfileID);
+    }
+    return descriptions;
+  }
+
+  const std::string m_cacheFile;
+  std::string m_originalGeometryCache;
+};
@@ -0,0 +1,104 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2025 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/Objects/MeshBoundingVolumeHierarchy.h"
+#include "MantidGeometry/Objects/MeshObjectCommon.h"
+#include "MantidKernel/V3D.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::V3D;
+
+class MeshBoundingVolumeHierarchyTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MeshBoundingVolumeHierarchyTest *createSuite() { return new MeshBoundingVolumeHierarchyTest(); }
+  static void destroySuite(MeshBoundingVolumeHierarchyTest *suite) { delete suite; }
+
+  void test_empty_mesh_has_no_candidates() {
+    MeshBoundingVolumeHierarchy hierarchy({}, {});
+    TS_ASSERT_EQUALS(hierarchy.numberOfNodes(), 0);
+    std::vector<size_t> candidates{1, 2};
+    hierarchy.getCandidateTriangles(V3D(0, 0, 0), V3D(1, 0, 0), candidates);
+    TS_ASSERT(candidates.empty());
+  }
+
+  void test_ray_missing_the_mesh_has_no_candidates() {
+    std::vector<V3D> vertices;
+    std::vector<uint32_t> triangles;
+    createTriangleSoup(1000, vertices, triangles);
+    MeshBoundingVolumeHierarchy hierarchy(triangles, vertices);
+    TS_ASSERT_LESS_THAN(1, hierarchy.numberOfNodes());
+
+    std::vector<size_t> candidates;
+    // pointing away from the mesh
+    hierarchy.getCandidateTriangles(V3D(5, 0, 0), V3D(1, 0, 0), candidates);
+    TS_ASSERT(candidates.empty());
+    // passing beside the mesh
+    hierarchy.getCandidateTriangles(V3D(-5, 3, 0), V3D(1, 0, 0), candidates);
+    TS_ASSERT(candidates.empty());
+  }
+
+  void test_candidates_hold_every_intersected_triangle() {
+    std::vector<V3D> vertices;
+    std::vector<uint32_t> triangles;
+    createTriangleSoup(1000, vertices, triangles);
+    MeshBoundingVolumeHierarchy hierarchy(triangles, vertices);
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> coordinate(-1.5, 1.5);
+    std::vector<size_t> candidates;
+    size_t numberOfIntersections(0);
+    for (size_t ray = 0; ray < 200; ++ray) {
+      const V3D start(coordinate(generator), coordinate(generator), coordinate(generator));
+      V3D direction(coordinate(generator), coordinate(generator), coordinate(generator));
+      // include rays along the axes, which have zero direction components
+      if (ray % 10 == 0)
+        direction = V3D(0, 0, ray % 20 == 0 ? 1 : -1);
+      direction.normalize();
+
+      hierarchy.getCandidateTriangles(start, direction, candidates);
+      TS_ASSERT(std::is_sorted(candidates.cbegin(), candidates.cend()));
+      TS_ASSERT(std::adjacent_find(candidates.cbegin(), candidates.cend()) == candidates.cend());
+      TS_ASSERT_LESS_THAN(candidates.size(), triangles.size() / 3);
+
+      V3D intersection;
+      TrackDirection entryExit;
+      for (size_t i = 0; i < triangles.size() / 3; ++i) {
+        if (MeshObjectCommon::rayIntersectsTriangle(start, direction, vertices[triangles[3 * i]],
+                                                    vertices[triangles[3 * i + 1]], vertices[triangles[3 * i + 2]],
+                                                    intersection, entryExit)) {
+          ++numberOfIntersections;
+          TS_ASSERT(std::binary_search(candidates.cbegin(), candidates.cend(), i));
+        }
+      }
+    }
+    TS_ASSERT_LESS_THAN(0, numberOfIntersections);
+  }
+
+private:
+  /// Small triangles scattered through the cube between -1 and 1
+  void createTriangleSoup(const size_t numberOfTriangles, std::vector<V3D> &vertices,
+                          std::vector<uint32_t> &triangles) {
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<double> centre(-1., 1.);
+    std::uniform_real_distribution<double> offset(-0.1, 0.1);
+    for (size_t i = 0; i < numberOfTriangles; ++i) {
+      const V3D c(centre(generator), centre(generator), centre(generator));
+      for (uint32_t corner = 0; corner < 3; ++corner) {
+        triangles.emplace_back(static_cast<uint32_t>(vertices.size()));
+        vertices.emplace_back(c + V3D(offset(generator), offset(generator), offset(generator)));
+      }
+    }
+  }
+};
@@ -294,6 +294,19 @@ public:
     checkTrackIntercept(std::move(geom_obj), track, expectedResults);
   }
 
+  void testInterceptTranslatedCube() {
+    std::vector<Link> expectedResults;
+    auto geom_obj = createCube(4.0);
+    geom_obj->translate(V3D(0, 0, 10));
+    Track track(V3D(-10, 1, 11), V3D(1, 0, 0));
+
+    // the cube must not be found where it was before the translation
+    Track oldTrack(V3D(-10, 1, 1), V3D(1, 0, 0));
+    TS_ASSERT_EQUALS(geom_obj->interceptSurface(oldTrack), 0);
+    expectedResults.emplace_back(Link(V3D(0, 1, 11), V3D(4, 1, 11), 14.0, *geom_obj));
+    checkTrackIntercept(std::move(geom_obj), track, expectedResults);
+  }
+
   void testInterceptCubeXY() {
     std::vector<Link> expectedResults;
     auto geom_obj = createCube(4.0);
@@ -171,4 +171,18 @@ public:
         beforeScatter.calculateAttenuation(lambdaBefore) * afterScatter.calculateAttenuation(lambdaAfter);
     TS_ASSERT_DELTA(0.0028357258, factor, 1e-8);
   }
+
+  void test_addAttenuationExponents_matches_calculateAttenuation() {
+    auto shape = ComponentCreationHelper::createSphere(0.1);
+    shape->setMaterial(Kernel::Material("Vanadium", Mantid::PhysicalConstants::getNeutronAtom(23), 0.02));
+    Track track({-0.05, -0.05, -0.05}, {-0.999343185, 0.025624184, 0.025624184});
+    track.addLink({-0.05, -0.05, -0.05}, {-0.071481137, -0.049449202, -0.049449202}, 0.021495255, *shape);
+    track.addLink({-0.08, -0.05, -0.05}, {-0.1, -0.049449202, -0.049449202}, 0.05, *shape);
+    const std::vector<double> lambdas{0.5, 2.5, 3.5};
+    std::vector<double> exponents(lambdas.size(), 1.0);
+    track.addAttenuationExponents(lambdas, exponents);
+    for (size_t i = 0; i < lambdas.size(); ++i) {
+      TS_ASSERT_DELTA(exp(1.0 - exponents[i]), track.calculateAttenuation(lambdas[i]), 1e-12);
+    }
+  }
 };
@@ -64,6 +64,9 @@ protected:
   /// Have the threads started?
   bool m_started;
 
+  /// Are the threads pinned to cores? Set by MultiThreaded.PinThreads
+  bool m_pinThreads;
+
   /// Progress reporter
   std::unique_ptr<ProgressBase> m_prog;
 
@@ -23,7 +23,8 @@ class ThreadScheduler;
  */
 class MANTID_KERNEL_DLL ThreadPoolRunnable : public Poco::Runnable {
 public:
-  ThreadPoolRunnable(size_t threadnum, ThreadScheduler *scheduler, ProgressBase *prog = nullptr, double waitSec = 0.0);
+  ThreadPoolRunnable(size_t threadnum, ThreadScheduler *scheduler, ProgressBase *prog = nullptr, double waitSec = 0.0,
+                     bool pinToCore = false, size_t core = 0);
 
   /// Return the thread number of this thread.
   size_t threadnum() { return m_threadnum; }
@@ -44,6 +45,12 @@ private:
 
   /// How many seconds you are allowed to wait with no tasks before exiting.
   double m_waitSec;
+
+  /// Should the thread be pinned to the NUMA node of a core while it runs?
+  bool m_pinToCore;
+
+  /// Index of the core whose node the thread is pinned to
+  size_t m_core;
 };
 
 } // namespace Kernel
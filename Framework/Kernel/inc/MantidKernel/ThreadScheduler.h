@@ -33,7 +33,7 @@ class MANTID_KERNEL_DLL ThreadScheduler {
 public:
   /** Constructor
    */
-  ThreadScheduler() : m_cost(0), m_costExecuted(0), m_abortException(""), m_aborted(false) {}
+  ThreadScheduler() : m_cost(0), m_costExecuted(0), m_abortException(""), m_aborted(false), m_numThreads(0) {}
 
   /// Destructor
   virtual ~ThreadScheduler() = default;
@@ -101,6 +101,12 @@ public:
   /// Returns true if the execution was aborted.
   bool getAborted() { return m_aborted; }
 
+  //-------------------------------------------------------------------------------
+  /// Returns the number of threads running the tasks, 0 if not known.
+  size_t numThreads() const { return m_numThreads; }
+  /// Sets the number of threads running the tasks, as done by ThreadPool.
+  void setNumThreads(const size_t numThreads) { m_numThreads = numThreads; }
+
 protected:
   /// Total cost of all tasks
   double m_cost;
@@ -112,6 +118,8 @@ protected:
   std::runtime_error m_abortException;
   /// The run was aborted due to an exception
   bool m_aborted;
+  /// Number of threads running the tasks, 0 if not known
+  size_t m_numThreads;
 };
 
 //===========================================================================
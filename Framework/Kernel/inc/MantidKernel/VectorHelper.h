@@ -10,8 +10,10 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidKernel/DllConfig.h"
+#include <algorithm>
 #include <cmath>
 #include <functional>
+#include <iterator>
 #include <stdexcept>
 #include <vector>
 
@@ -76,6 +78,33 @@ template <typename T> std::vector<T> flattenVector(const std::vector<std::vector
   return flattened;
 }
 
+/**
+ * Find the first element in a partitioned range for which the predicate is false, like std::partition_point, but
+ * searching outwards from the start of the range in steps that double in size. The cost is logarithmic in the distance
+ * to the result rather than in the size of the range, so walking a sorted vector through many nearby boundaries skips
+ * the elements in between cheaply.
+ *
+ * @param first :: start of the range, which must be partitioned by the predicate
+ * @param last :: end of the range
+ * @param pred :: predicate that is true for all elements before the result and false for all after
+ * @return iterator to the first element for which pred is false, or last if there is none
+ */
+template <typename Iterator, typename Predicate>
+Iterator gallopPartitionPoint(Iterator first, const Iterator last, const Predicate &pred) {
+  if (first == last || !pred(*first))
+    return first;
+  // the element at first always passes the predicate from here on
+  typename std::iterator_traits<Iterator>::difference_type step = 1;
+  while (step < std::distance(first, last)) {
+    const auto probe = std::next(first, step);
+    if (!pred(*probe))
+      return std::partition_point(std::next(first), probe, pred);
+    first = probe;
+    step *= 2;
+  }
+  return std::partition_point(std::next(first), last, pred);
+}
+
 template <typename NumT>
 MANTID_KERNEL_DLL std::vector<NumT> splitStringIntoVector(std::string listString, const std::string &separators = ", ");
 
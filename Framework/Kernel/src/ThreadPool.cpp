@@ -18,6 +18,7 @@
 #include <Poco/Thread.h>
 
 #include <algorithm>
+#include <atomic>
 #include <sstream>
 #include <stdexcept>
 // needed on windows and any place missing openmp
@@ -27,6 +28,11 @@
 
 namespace Mantid::Kernel {
 
+namespace {
+/// The core the threads of the next pool are pinned from, so pools running at the same time use different cores
+std::atomic<size_t> g_nextPinnedCore{0};
+} // namespace
+
 //--------------------------------------------------------------------------------
 /** Constructor
  *
@@ -41,7 +47,7 @@ namespace Mantid::Kernel {
  *        NOTE: The ThreadPool destructor will delete this.
  */
 ThreadPool::ThreadPool(ThreadScheduler *scheduler, size_t numThreads, ProgressBase *prog)
-    : m_scheduler(std::unique_ptr<ThreadScheduler>(scheduler)), m_started(false),
+    : m_scheduler(std::unique_ptr<ThreadScheduler>(scheduler)), m_started(false), m_pinThreads(false),
       m_prog(std::unique_ptr<ProgressBase>(prog)) {
   if (!m_scheduler)
     throw std::invalid_argument("NULL ThreadScheduler passed to ThreadPool constructor.");
@@ -52,6 +58,11 @@ ThreadPool::ThreadPool(ThreadScheduler *scheduler, size_t numThreads, ProgressBa
   } else
     m_numThreads = numThreads;
   // std::cout << m_numThreads << " m_numThreads \n";
+  // work the tasks divide further, e.g. with TBB, should not run on more threads than the pool
+  m_scheduler->setNumThreads(m_numThreads);
+
+  // Pinning stops the kernel migrating threads away from the NUMA node holding the memory they allocated
+  m_pinThreads = Kernel::ConfigService::Instance().getValue<bool>("MultiThreaded.PinThreads").value_or(false);
 }
 
 //--------------------------------------------------------------------------------
@@ -97,6 +108,7 @@ void ThreadPool::start(double waitSec) {
   // Now, launch that many threads and let them wait for new tasks.
   m_threads.clear();
   m_runnables.clear();
+  const size_t firstCore = m_pinThreads ? g_nextPinnedCore.fetch_add(m_numThreads) : 0;
   for (size_t i = 0; i < m_numThreads; i++) {
     // Make a descriptive name
     std::ostringstream name;
@@ -104,7 +116,8 @@ void ThreadPool::start(double waitSec) {
     // Create the thread
     auto thread = std::make_unique<Poco::Thread>(name.str());
     // Make the runnable object and run it
-    auto runnable = std::make_unique<ThreadPoolRunnable>(i, m_scheduler.get(), m_prog.get(), waitSec);
+    auto runnable =
+        std::make_unique<ThreadPoolRunnable>(i, m_scheduler.get(), m_prog.get(), waitSec, m_pinThreads, firstCore + i);
     thread->start(*runnable);
     m_threads.emplace_back(std::move(thread));
     m_runnables.emplace_back(std::move(runnable));
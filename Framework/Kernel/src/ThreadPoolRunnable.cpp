@@ -6,13 +6,112 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidKernel/ThreadPoolRunnable.h"
 #include "MantidKernel/ProgressBase.h"
+#include "MantidKernel/System.h"
 #include "MantidKernel/Task.h"
 #include "MantidKernel/ThreadScheduler.h"
 
 #include <Poco/Thread.h>
 
+#include <optional>
+
+#ifdef __linux__
+#include "MantidKernel/Strings.h"
+
+#include <filesystem>
+#include <fstream>
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace Mantid::Kernel {
 
+namespace {
+#ifdef __linux__
+/** The allowed CPUs on the same NUMA node as a CPU, as listed in sysfs
+ * @param cpu :: the CPU whose node is wanted
+ * @param allowed :: the CPUs the process may run on
+ * @return the allowed CPUs of the node, or all the allowed CPUs if the node is not known
+ */
+cpu_set_t allowedCpusOnNode(const int cpu, const cpu_set_t &allowed) {
+  cpu_set_t node;
+  CPU_ZERO(&node);
+  // the CPU directory holds a link named after its node, e.g. node0
+  std::error_code error;
+  const std::filesystem::directory_iterator end;
+  for (auto entry = std::filesystem::directory_iterator("/sys/devices/system/cpu/cpu" + std::to_string(cpu), error);
+       !error && entry != end; entry.increment(error)) {
+    if (entry->path().filename().string().rfind("node", 0) != 0)
+      continue;
+    std::ifstream cpulist(entry->path() / "cpulist");
+    std::string list;
+    std::getline(cpulist, list);
+    try {
+      for (const auto nodeCpu : Strings::parseRange(list))
+        if (nodeCpu >= 0 && nodeCpu < CPU_SETSIZE)
+          CPU_SET(nodeCpu, &node);
+    } catch (std::exception &) {
+      CPU_ZERO(&node);
+    }
+    break;
+  }
+  CPU_AND(&node, &node, &allowed);
+  return CPU_COUNT(&node) > 0 ? node : allowed;
+}
+#endif
+
+/** Pins the calling thread to the NUMA node of one of the cores the process is allowed to run on, and restores its
+ * affinity when destroyed. The thread may run on any core of the node, so the memory it first touches stays local to
+ * it, and OpenMP or TBB threads started by its tasks are not confined to a single core.
+ * Does nothing on platforms without thread affinity support.
+ */
+class ThreadPinning {
+public:
+  /// @param core :: index among the allowed cores of the core whose node is used, wrapping around
+  explicit ThreadPinning(const size_t core) {
+#ifdef __linux__
+    CPU_ZERO(&m_previous);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(m_previous), &m_previous) != 0)
+      return;
+    const auto numAllowed = static_cast<size_t>(CPU_COUNT(&m_previous));
+    if (numAllowed == 0)
+      return;
+
+    // find the n-th allowed core
+    size_t n = core % numAllowed;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (!CPU_ISSET(cpu, &m_previous))
+        continue;
+      if (n-- == 0) {
+        const auto node = allowedCpusOnNode(cpu, m_previous);
+        m_pinned = pthread_setaffinity_np(pthread_self(), sizeof(node), &node) == 0;
+        return;
+      }
+    }
+#else
+    UNUSED_ARG(core);
+#endif
+  }
+
+  ~ThreadPinning() {
+#ifdef __linux__
+    if (m_pinned)
+      pthread_setaffinity_np(pthread_self(), sizeof(m_previous), &m_previous);
+#endif
+  }
+
+  ThreadPinning(const ThreadPinning &) = delete;
+  ThreadPinning &operator=(const ThreadPinning &) = delete;
+
+private:
+#ifdef __linux__
+  /// The affinity of the thread before it was pinned
+  cpu_set_t m_previous;
+  /// Was the thread pinned?
+  bool m_pinned{false};
+#endif
+};
+} // namespace
+
 //-----------------------------------------------------------------------------------
 /** Constructor
  *
@@ -23,9 +122,15 @@ namespace Mantid::Kernel {
  *        automatic progress reporting will be handled by the thread pool.
  * @param waitSec :: how many seconds the thread is allowed to wait with no
  *tasks.
+ * @param pinToCore :: if true, the thread is pinned to the NUMA node of a core
+ *while it runs.
+ * @param core :: index among the cores the process may use of the core whose
+ *node the thread is pinned to.
  */
-ThreadPoolRunnable::ThreadPoolRunnable(size_t threadnum, ThreadScheduler *scheduler, ProgressBase *prog, double waitSec)
-    : m_threadnum(threadnum), m_scheduler(scheduler), m_prog(prog), m_waitSec(waitSec) {
+ThreadPoolRunnable::ThreadPoolRunnable(size_t threadnum, ThreadScheduler *scheduler, ProgressBase *prog, double waitSec,
+                                       bool pinToCore, size_t core)
+    : m_threadnum(threadnum), m_scheduler(scheduler), m_prog(prog), m_waitSec(waitSec), m_pinToCore(pinToCore),
+      m_core(core) {
   if (!m_scheduler)
     throw std::invalid_argument("NULL ThreadScheduler passed to ThreadPoolRunnable::ctor()");
 }
@@ -39,6 +144,10 @@ void ThreadPoolRunnable::clearWait() { m_waitSec = 0.0; }
  * as scheduled to it.
  */
 void ThreadPoolRunnable::run() {
+  std::optional<ThreadPinning> pinning;
+  if (m_pinToCore)
+    pinning.emplace(m_core);
+
   std::shared_ptr<Task> task;
 
   // If there are no tasks yet, wait up to m_waitSec for them to come up
@@ -8,6 +8,7 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/FunctionTask.h"
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/ThreadPool.h"
@@ -19,11 +20,31 @@
 
 #include <cstdlib>
 #include <memory>
+#include <mutex>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
 
 using namespace Mantid::Kernel;
 
 //=======================================================================================
 
+/// Pins the threads of pools made while it exists, restoring the setting when it goes out of scope
+class PinThreadsSetting {
+public:
+  PinThreadsSetting() : m_previous(ConfigService::Instance().getString("MultiThreaded.PinThreads")) {
+    ConfigService::Instance().setString("MultiThreaded.PinThreads", "1");
+  }
+  ~PinThreadsSetting() { ConfigService::Instance().setString("MultiThreaded.PinThreads", m_previous); }
+
+private:
+  const std::string m_previous;
+};
+
+//=======================================================================================
+
 class TimeWaster {
 public:
   static size_t waste_time(double seconds) {
@@ -140,6 +161,13 @@ public:
 
   void test_Constructor() { ThreadPool p; }
 
+  void test_scheduler_knows_the_number_of_threads() {
+    auto *scheduler = new ThreadSchedulerFIFO();
+    TS_ASSERT_EQUALS(scheduler->numThreads(), 0);
+    ThreadPool p(scheduler, 3);
+    TS_ASSERT_EQUALS(scheduler->numThreads(), 3);
+  }
+
   void test_schedule() {
     ThreadPool p;
     TS_ASSERT_EQUALS(threadpooltest_check, 0);
@@ -149,6 +177,56 @@ public:
     TS_ASSERT_EQUALS(threadpooltest_check, 12);
   }
 
+  void test_schedule_with_pinned_threads() {
+    PinThreadsSetting setting;
+
+    ThreadPool p(new ThreadSchedulerFIFO(), 2);
+    TimeWaster mywaster;
+    mywaster.total = 0;
+    for (int i = 0; i < 10; i++)
+      p.schedule(std::make_shared<FunctionTask>(std::bind(&TimeWaster::add_to_number, &mywaster, i)));
+    TS_ASSERT_THROWS_NOTHING(p.joinAll());
+    TS_ASSERT_EQUALS(mywaster.total, 45);
+  }
+
+#ifdef __linux__
+  void test_pinned_threads_run_on_allowed_cores_and_leave_the_caller_unpinned() {
+    PinThreadsSetting setting;
+
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    TS_ASSERT_EQUALS(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+
+    std::mutex mutex;
+    std::vector<cpu_set_t> workerAffinities;
+    ThreadPool p(new ThreadSchedulerFIFO(), 4);
+    for (int i = 0; i < 8; i++) {
+      p.schedule(std::make_shared<FunctionTask>([&mutex, &workerAffinities]() {
+        cpu_set_t affinity;
+        CPU_ZERO(&affinity);
+        sched_getaffinity(0, sizeof(affinity), &affinity);
+        std::lock_guard<std::mutex> lock(mutex);
+        workerAffinities.emplace_back(affinity);
+      }));
+    }
+    TS_ASSERT_THROWS_NOTHING(p.joinAll());
+
+    TS_ASSERT_EQUALS(workerAffinities.size(), 8);
+    for (auto &affinity : workerAffinities) {
+      // each worker may run on some of the allowed cores only
+      TS_ASSERT_LESS_THAN(0, CPU_COUNT(&affinity));
+      cpu_set_t allowedAffinity;
+      CPU_AND(&allowedAffinity, &affinity, &allowed);
+      TS_ASSERT(CPU_EQUAL(&allowedAffinity, &affinity));
+    }
+
+    cpu_set_t callerAffinity;
+    CPU_ZERO(&callerAffinity);
+    sched_getaffinity(0, sizeof(callerAffinity), &callerAffinity);
+    TS_ASSERT(CPU_EQUAL(&callerAffinity, &allowed));
+  }
+#endif
+
   //=======================================================================================
   //=======================================================================================
   /** Class for debugging progress reporting */
@@ -298,6 +298,23 @@ public:
     }
   }
 
+  void test_gallopPartitionPoint() {
+    std::vector<int> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+    for (const int seek : {-1, 0, 1, 2, 3, 7, 8, 500, 998, 999, 1000, 2000}) {
+      const auto expected = std::lower_bound(values.cbegin(), values.cend(), seek);
+      const auto found =
+          VectorHelper::gallopPartitionPoint(values.cbegin(), values.cend(), [seek](const int x) { return x < seek; });
+      TS_ASSERT_EQUALS(std::distance(values.cbegin(), found), std::distance(values.cbegin(), expected));
+    }
+  }
+
+  void test_gallopPartitionPoint_empty_range() {
+    const std::vector<int> values;
+    TS_ASSERT(VectorHelper::gallopPartitionPoint(values.cbegin(), values.cend(), [](const int) { return true; }) ==
+              values.cend());
+  }
+
   // TODO: More tests of other methods
 
   void test_splitStringIntoVector() {
@@ -61,6 +61,12 @@ private:
   /// Helper method
   template <typename MDE, size_t nd> void binByIterating(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
 
+  /// Find the bin holding every vertex of a box, if there is one
+  bool getSingleBinIndex(const API::IMDNode &box, const size_t *const chunkMin, const size_t *const chunkMax,
+                         size_t &linearIndex) const;
+  /// Add the cached contents of a box to a bin
+  void addBoxToBin(const API::IMDNode &box, const size_t linearIndex);
+
   /// Method to bin a single MDBox
   template <typename MDE, size_t nd>
   void binMDBox(DataObjects::MDBox<MDE, nd> *box, const size_t *const chunkMin, const size_t *const chunkMax);
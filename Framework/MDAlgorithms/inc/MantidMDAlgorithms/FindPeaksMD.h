@@ -22,7 +22,6 @@
 namespace Mantid {
 namespace Geometry {
 class ComponentInfo;
-class InstrumentRayTracer;
 } // namespace Geometry
 namespace MDAlgorithms {
 
@@ -61,16 +60,19 @@ private:
   void checkWorkspaceDims(const Mantid::API::IMDWorkspace_sptr &ws);
   void determineOutputType(const std::string &peakType, const uint16_t numExperimentInfo);
 
-  /// Adds a peak based on Q, bin count & a set of detector IDs
-  void addPeak(const Geometry::ComponentInfo &compInfo, const Mantid::Kernel::V3D &Q, const double binCount,
-               const Geometry::InstrumentRayTracer &tracer);
+  /// Creates a peak based on Q, bin count to be added once its detector is found
+  void addPeak(const Mantid::Kernel::V3D &Q, const double binCount,
+               std::vector<std::shared_ptr<DataObjects::Peak>> &peaks);
+
+  /// Finds the detectors of peaks in one batch and adds the peaks on a detector
+  void addPeaksOnDetectors(const Mantid::API::ExperimentInfo &ei,
+                           const std::vector<std::shared_ptr<DataObjects::Peak>> &peaks);
 
   /// Adds a peak based on Q, bin count
   void addLeanElasticPeak(const Mantid::Kernel::V3D &Q, const double binCount, const bool useGoniometer = false);
 
   /// Adds a peak based on Q, bin count
-  std::shared_ptr<DataObjects::Peak> createPeak(const Mantid::Kernel::V3D &Q, const double binCount,
-                                                const Geometry::InstrumentRayTracer &tracer);
+  std::shared_ptr<DataObjects::Peak> createPeak(const Mantid::Kernel::V3D &Q, const double binCount);
 
   /// Adds a peak based on Q, bin count
   std::shared_ptr<DataObjects::LeanElasticPeak>
@@ -58,8 +58,8 @@ private:
   std::vector<coord_t> getValuesFromOtherDimensions(bool &skipNormalization, uint16_t expInfoIndex = 0) const;
 
   void cacheDimensionXValues();
-  void calculateNormalization(const std::vector<coord_t> &otherValues, const Geometry::SymmetryOperation &so,
-                              uint16_t expInfoIndex, size_t soIndex);
+  void calculateNormalization(const std::vector<coord_t> &otherValues,
+                              const std::vector<Geometry::SymmetryOperation> &symmetryOps, uint16_t expInfoIndex);
 
   void calculateIntersections(std::vector<std::array<double, 4>> &intersections, const double theta, const double phi,
                               const Kernel::DblMatrix &transform, double lowvalue, double highvalue);
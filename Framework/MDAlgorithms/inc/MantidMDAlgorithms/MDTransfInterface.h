@@ -136,6 +136,39 @@ public:
       * */
   virtual bool calcMatrixCoord(const double &X, std::vector<coord_t> &Coord, double &signal, double &errSq) const = 0;
 
+  /** The method to calculate all remaining coordinates for every value of a
+     spectrum in one call, so the transformation is dispatched once per spectrum
+     rather than once per value. The default implementation calls
+     calcMatrixCoord for every value; transformations may override it with a
+     loop the compiler can vectorize.
+      * @param X      -- X values of the spectrum
+      * @param Coord  -- vector of MD coordinates with the generic and
+     Y-dependent coordinates set. Used as the template for the coordinates of
+     every value
+      * @param signal -- signal values which can change or remain unchanged
+     depending on MD coordinates
+      * @param errSq  -- squared error values, changed along with the signals
+      * @param allCoord -- the MD coordinates of every value within the range
+     requested by algorithm are appended to this vector
+      * @param accepted -- set to 1 for the values within the range requested by
+     algorithm and to 0 otherwise
+      * @return the number of values within the range requested by algorithm
+      * */
+  virtual size_t calcMatrixCoords(const std::vector<double> &X, std::vector<coord_t> &Coord,
+                                  std::vector<double> &signal, std::vector<double> &errSq,
+                                  std::vector<coord_t> &allCoord, std::vector<char> &accepted) const {
+    accepted.resize(X.size());
+    size_t nAccepted(0);
+    for (size_t i = 0; i < X.size(); ++i) {
+      accepted[i] = calcMatrixCoord(X[i], Coord, signal[i], errSq[i]);
+      if (accepted[i]) {
+        allCoord.insert(allCoord.end(), Coord.begin(), Coord.end());
+        ++nAccepted;
+      }
+    }
+    return nAccepted;
+  }
+
   /* clone method allowing to provide the copy of the particular class */
   virtual MDTransfInterface *clone() const = 0;
   // destructor
@@ -37,6 +37,9 @@ public:
   bool calcYDepCoordinates(std::vector<coord_t> &Coord, size_t i) override;
   bool calcMatrixCoord(const double &deltaEOrK0, std::vector<coord_t> &Coord, double &signal,
                        double &ErrSq) const override;
+  size_t calcMatrixCoords(const std::vector<double> &X, std::vector<coord_t> &Coord, std::vector<double> &signal,
+                          std::vector<double> &errSq, std::vector<coord_t> &allCoord,
+                          std::vector<char> &accepted) const override;
   // constructor;
   MDTransfModQ();
   /* clone method allowing to provide the copy of the particular class */
@@ -109,6 +112,11 @@ protected:
   // remove
   int *m_pDetMasks;
 
+  size_t appendAcceptedCoords(const std::vector<coord_t> &matrixCoord, std::vector<coord_t> &Coord,
+                              const std::vector<char> &accepted, std::vector<coord_t> &allCoord) const;
+  void calcInelasticWaveVectors(const std::vector<double> &X, std::vector<double> &kPerpendicular,
+                                std::vector<double> &qAlongBeam) const;
+
 private:
   /// how to transform workspace data in elastic case
   inline bool calcMatrixCoordElastic(const double &k0, std::vector<coord_t> &Coord) const;
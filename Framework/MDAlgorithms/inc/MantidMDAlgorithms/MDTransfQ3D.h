@@ -32,6 +32,9 @@ public:
   const std::string transfID() const override;
   bool calcYDepCoordinates(std::vector<coord_t> &Coord, size_t i) override;
   bool calcMatrixCoord(const double &deltaEOrK0, std::vector<coord_t> &Coord, double &s, double &err) const override;
+  size_t calcMatrixCoords(const std::vector<double> &X, std::vector<coord_t> &Coord, std::vector<double> &signal,
+                          std::vector<double> &errSq, std::vector<coord_t> &allCoord,
+                          std::vector<char> &accepted) const override;
   // constructor;
   MDTransfQ3D();
   /* clone method allowing to provide the copy of the particular class */
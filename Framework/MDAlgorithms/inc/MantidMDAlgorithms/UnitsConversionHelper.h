@@ -65,6 +65,7 @@ public:
                   const DataObjects::TableWorkspace_const_sptr &DetWS, int Emode, bool forceViaTOF = false);
   void updateConversion(size_t i);
   double convertUnits(double val) const;
+  void convertUnits(std::vector<double> &values) const;
 
   bool isUnitConverted() const;
   std::pair<double, double> getConversionRange(double x1, double x2) const;
@@ -81,90 +81,95 @@ void BinMD::init() {
 }
 
 //----------------------------------------------------------------------------------------------
-/** Bin the contents of a MDBox
+/** Find whether every vertex of a box falls in the same output bin, in which
+ * case the cached signal of the box can be added to that bin without looking
+ * at its events.
  *
- * @param box :: pointer to the MDBox to bin
+ * @param box :: the box (MDBox or MDGridBox) to check
  * @param chunkMin :: the minimum index in each dimension to consider "valid"
  *(inclusive)
  * @param chunkMax :: the maximum index in each dimension to consider "valid"
  *(exclusive)
+ * @param linearIndex :: set to the linear index of the bin holding the box
+ * @return true if the entire box is within a single bin of the chunk
  */
-template <typename MDE, size_t nd>
-inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin, const size_t *const chunkMax) {
+bool BinMD::getSingleBinIndex(const API::IMDNode &box, const size_t *const chunkMin, const size_t *const chunkMax,
+                              size_t &linearIndex) const {
+  const size_t nd = box.getNumDims();
   // An array to hold the rotated/transformed coordinates
   auto outCenter = std::vector<coord_t>(m_outD);
 
-  // Evaluate whether the entire box is in the same bin
-  if (box->getNPoints() > (1 << nd) * 2) {
-    // There is a check that the number of events is enough for it to make sense
-    // to do all this processing.
-    size_t numVertexes = 0;
-    auto vertexes = box->getVertexesArray(numVertexes);
-
-    // All vertexes have to be within THE SAME BIN = have the same linear index.
-    size_t lastLinearIndex = 0;
-    bool badOne = false;
-
-    for (size_t i = 0; i < numVertexes; i++) {
-      // Cache the center of the event (again for speed)
-      const coord_t *inCenter = vertexes.get() + i * nd;
+  size_t numVertexes = 0;
+  auto vertexes = box.getVertexesArray(numVertexes);
 
-      // Now transform to the output dimensions
-      m_transform->apply(inCenter, outCenter.data());
-
-      // To build up the linear index
-      size_t linearIndex = 0;
-      // To mark VERTEXES outside range
-      badOne = false;
-
-      /// Loop through the dimensions on which we bin
-      for (size_t bd = 0; bd < m_outD; bd++) {
-        // What is the bin index in that dimension
-        coord_t x = outCenter[bd];
-        auto ix = size_t(x);
-        // Within range (for this chunk)?
-        if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd])) {
-          // Build up the linear index
-          linearIndex += indexMultiplier[bd] * ix;
-        } else {
-          // Outside the range
-          badOne = true;
-          break;
-        }
-      } // (for each dim in MDHisto)
+  // All vertexes have to be within THE SAME BIN = have the same linear index.
+  for (size_t i = 0; i < numVertexes; i++) {
+    // Now transform to the output dimensions
+    m_transform->apply(vertexes.get() + i * nd, outCenter.data());
 
-      // Is the vertex at the same place as the last one?
-      if (!badOne) {
-        if ((i > 0) && (linearIndex != lastLinearIndex)) {
-          // Change of index
-          badOne = true;
-          break;
-        }
-        lastLinearIndex = linearIndex;
-      }
+    // To build up the linear index
+    size_t vertexLinearIndex = 0;
+    /// Loop through the dimensions on which we bin
+    for (size_t bd = 0; bd < m_outD; bd++) {
+      // What is the bin index in that dimension
+      coord_t x = outCenter[bd];
+      auto ix = size_t(x);
+      // Within range (for this chunk)?
+      if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd]))
+        vertexLinearIndex += indexMultiplier[bd] * ix;
+      else
+        // The vertex is outside the range
+        return false;
+    } // (for each dim in MDHisto)
 
-      // Was the vertex completely outside the range?
-      if (badOne)
-        break;
-    } // (for each vertex)
+    // Is the vertex at the same place as the last one?
+    if ((i > 0) && (vertexLinearIndex != linearIndex))
+      return false;
+    linearIndex = vertexLinearIndex;
+  } // (for each vertex)
+  return numVertexes > 0;
+}
 
-    if (!badOne) {
-      // Yes, the entire box is within a single bin
-      //        std::cout << "Box at " << box->getExtentsStr() << " is within a
-      //        single bin.\n";
-      // Add the CACHED signal from the entire box
-      signals[lastLinearIndex] += box->getSignal();
-      errors[lastLinearIndex] += box->getErrorSquared();
-      // TODO: If DataObjects get a weight, this would need to get the summed
-      // weight.
-      numEvents[lastLinearIndex] += static_cast<signal_t>(box->getNPoints());
+//----------------------------------------------------------------------------------------------
+/** Add the cached signal, error and number of events of an entire box to a
+ * bin.
+ *
+ * @param box :: the box whose contents all lie in the bin
+ * @param linearIndex :: the linear index of the bin
+ */
+void BinMD::addBoxToBin(const API::IMDNode &box, const size_t linearIndex) {
+  signals[linearIndex] += box.getSignal();
+  errors[linearIndex] += box.getErrorSquared();
+  // TODO: If DataObjects get a weight, this would need to get the summed
+  // weight.
+  numEvents[linearIndex] += static_cast<signal_t>(box.getNPoints());
+}
 
-      // And don't bother looking at each event. This may save lots of time
-      // loading from disk.
-      return;
-    }
+//----------------------------------------------------------------------------------------------
+/** Bin the contents of a MDBox
+ *
+ * @param box :: pointer to the MDBox to bin
+ * @param chunkMin :: the minimum index in each dimension to consider "valid"
+ *(inclusive)
+ * @param chunkMax :: the maximum index in each dimension to consider "valid"
+ *(exclusive)
+ */
+template <typename MDE, size_t nd>
+inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin, const size_t *const chunkMax) {
+  // Evaluate whether the entire box is in the same bin. There is a check that
+  // the number of events is enough for it to make sense to do all this
+  // processing.
+  size_t linearIndex = 0;
+  if (box->getNPoints() > (1 << nd) * 2 && getSingleBinIndex(*box, chunkMin, chunkMax, linearIndex)) {
+    // Add the CACHED signal from the entire box and don't bother looking at
+    // each event. This may save lots of time loading from disk.
+    addBoxToBin(*box, linearIndex);
+    return;
   }
 
+  // An array to hold the rotated/transformed coordinates
+  auto outCenter = std::vector<coord_t>(m_outD);
+
   // If you get here, you could not determine that the entire box was in the
   // same bin.
   // So you need to iterate through events.
@@ -292,10 +297,46 @@ template <typename MDE, size_t nd> void BinMD::binByIterating(typename MDEventWo
       // MDEventWorkspace)
       auto function = this->getImplicitFunctionForChunk(chunkMin.data(), chunkMax.data());
 
-      // Use getBoxes() to get an array with a pointer to each box
+      // Use getBoxes() to get an array with a pointer to each box touching
+      // the chunk, parents before their children. No depth limit.
+      std::vector<API::IMDNode *> touching;
+      ws->getBox()->getBoxes(touching, 1000, false, function.get());
+      // Whether each box holds a masked box: its own flag for a leaf, and the flags of its contents, which follow
+      // it in the list, for a gridded box. Worked out in one pass from the end of the list, as asking a gridded box
+      // walks its whole subtree.
+      std::vector<bool> holdsMasked(touching.size(), false);
+      // by depth, whether the boxes seen since the last box one level up hold a masked box
+      std::vector<bool> maskedAtDepth;
+      for (size_t i = touching.size(); i-- > 0;) {
+        const API::IMDNode *node = touching[i];
+        const auto depth = static_cast<size_t>(node->getDepth());
+        if (maskedAtDepth.size() < depth + 2)
+          maskedAtDepth.resize(depth + 2, false);
+        holdsMasked[i] = node->isLeaf() ? node->getIsMasked() : maskedAtDepth[depth + 1];
+        maskedAtDepth[depth + 1] = false;
+        if (holdsMasked[i])
+          maskedAtDepth[depth] = true;
+      }
+
+      // Keep the leaves, except where a whole gridded box lies in one bin: its
+      // cached signal is added right away and none of its boxes are looked at.
       std::vector<API::IMDNode *> boxes;
-      // Leaf-only; no depth limit; with the implicit function passed to it.
-      ws->getBox()->getBoxes(boxes, 1000, true, function.get());
+      for (size_t i = 0; i < touching.size(); ++i) {
+        API::IMDNode *node = touching[i];
+        if (node->isLeaf()) {
+          boxes.emplace_back(node);
+          continue;
+        }
+        size_t linearIndex = 0;
+        if (node->getNPoints() > (size_t{1} << nd) * 2 && !holdsMasked[i] &&
+            getSingleBinIndex(*node, chunkMin.data(), chunkMax.data(), linearIndex)) {
+          addBoxToBin(*node, linearIndex);
+          // Skip the contents, which follow the box in the list
+          const auto depth = node->getDepth();
+          while (i + 1 < touching.size() && touching[i + 1]->getDepth() > depth)
+            ++i;
+        }
+      }
 
       // Sort boxes by file position IF file backed. This reduces seeking time,
       // hopefully.
@@ -41,9 +41,6 @@ template <class T> size_t ConvToMDEventsWS::convertEventList(size_t workspaceInd
 
   allCoord.reserve(this->m_NDims * numEvents);
   sig_err.reserve(2 * numEvents);
-  expInfoIndex.reserve(numEvents);
-  goniometer_index.reserve(numEvents);
-  det_ids.reserve(numEvents);
 
   // This little dance makes the getting vector of events more general (since
   // you can't overload by return type).
@@ -51,21 +48,28 @@ template <class T> size_t ConvToMDEventsWS::convertEventList(size_t workspaceInd
   getEventsFrom(el, events_ptr);
   const typename std::vector<T> &events = *events_ptr;
 
-  // Iterators to start/end
-  for (auto it = events.cbegin(); it != events.cend(); it++) {
-    double val = localUnitConv.convertUnits(it->tof());
-    double signal = it->weight();
-    double errorSq = it->errorSquared();
-    if (!m_QConverter->calcMatrixCoord(val, locCoord, signal, errorSq))
-      continue; // skip ND outside the range
+  // gather the values of all events, so that they are converted to MD
+  // coordinates in one call for the whole spectrum
+  std::vector<double> xValues(numEvents), signal(numEvents), errorSq(numEvents);
+  for (size_t i = 0; i < numEvents; ++i) {
+    xValues[i] = events[i].tof();
+    signal[i] = events[i].weight();
+    errorSq[i] = events[i].errorSquared();
+  }
+  localUnitConv.convertUnits(xValues);
 
-    sig_err.emplace_back(static_cast<float>(signal));
-    sig_err.emplace_back(static_cast<float>(errorSq));
-    expInfoIndex.emplace_back(expInfoIndexLoc);
-    goniometer_index.emplace_back(0); // default value
-    det_ids.emplace_back(detID);
-    allCoord.insert(allCoord.end(), locCoord.begin(), locCoord.end());
+  std::vector<char> accepted;
+  const size_t nAccepted = m_QConverter->calcMatrixCoords(xValues, locCoord, signal, errorSq, allCoord, accepted);
+
+  for (size_t i = 0; i < numEvents; ++i) {
+    if (!accepted[i])
+      continue; // skip ND outside the range
+    sig_err.emplace_back(static_cast<float>(signal[i]));
+    sig_err.emplace_back(static_cast<float>(errorSq[i]));
   }
+  expInfoIndex.assign(nAccepted, expInfoIndexLoc);
+  goniometer_index.assign(nAccepted, 0); // default value
+  det_ids.assign(nAccepted, detID);
 
   // Add them to the MDEW
   size_t n_added_events = expInfoIndex.size();
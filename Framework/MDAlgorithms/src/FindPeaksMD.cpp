@@ -10,14 +10,19 @@
 #include "MantidDataObjects/MDHistoWorkspace.h"
 #include "MantidGeometry/Crystal/EdgePixel.h"
 #include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorBoundingVolumeHierarchy.h"
 #include "MantidGeometry/Instrument/Goniometer.h"
-#include "MantidGeometry/Objects/InstrumentRayTracer.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/VMD.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <map>
+#include <optional>
 #include <vector>
 
 using namespace Mantid::Kernel;
@@ -95,6 +100,73 @@ template <typename MDE, size_t nd> void addDetectors(DataObjects::Peak &peak, MD
   // Compile time deduction of the correct function call
   addDetectors(peak, box, IsFullEvent<MDE, nd>());
 }
+
+/**
+ * The centres of the peaks found so far, bucketed by their first three
+ * coordinates into cells as wide as the peak distance threshold. A centre
+ * closer than the threshold to another can only lie in the same or a
+ * neighbouring cell, so only those need to be compared.
+ */
+class PeakCentreGrid {
+public:
+  PeakCentreGrid(const size_t nd, const coord_t radiusSquared)
+      : m_nd(nd), m_radiusSquared(radiusSquared), m_cellSize(std::sqrt(radiusSquared)) {}
+
+  /// @return true if a centre already added is closer than the threshold
+  bool hasNeighbour(const coord_t *centre) const {
+    if (!(m_radiusSquared > 0))
+      return false;
+    const auto cell = cellOf(centre);
+    CellIndex neighbour;
+    for (int64_t dx = -1; dx <= 1; ++dx)
+      for (int64_t dy = -1; dy <= 1; ++dy)
+        for (int64_t dz = -1; dz <= 1; ++dz) {
+          neighbour = {{cell[0] + dx, cell[1] + dy, cell[2] + dz}};
+          const auto found = m_cells.find(neighbour);
+          if (found == m_cells.end())
+            continue;
+          for (const size_t index : found->second) {
+            if (distanceSquared(centre, m_centres.data() + index * m_nd) < m_radiusSquared)
+              return true;
+          }
+        }
+    return false;
+  }
+
+  void add(const coord_t *centre) {
+    if (!(m_radiusSquared > 0))
+      return;
+    m_cells[cellOf(centre)].emplace_back(m_centres.size() / m_nd);
+    m_centres.insert(m_centres.end(), centre, centre + m_nd);
+  }
+
+private:
+  using CellIndex = std::array<int64_t, 3>;
+
+  CellIndex cellOf(const coord_t *centre) const {
+    CellIndex cell;
+    for (size_t d = 0; d < 3; d++)
+      cell[d] = static_cast<int64_t>(std::floor(centre[d] / m_cellSize));
+    return cell;
+  }
+
+  coord_t distanceSquared(const coord_t *centre, const coord_t *other) const {
+    coord_t distSquared = 0.0;
+    for (size_t d = 0; d < m_nd; d++) {
+      coord_t dist = other[d] - centre[d];
+      distSquared += (dist * dist);
+    }
+    return distSquared;
+  }
+
+  const size_t m_nd;
+  const coord_t m_radiusSquared;
+  const coord_t m_cellSize;
+  /// Indexes of the centres in each occupied cell
+  std::map<CellIndex, std::vector<size_t>> m_cells;
+  /// The coordinates of all the centres, one after another
+  std::vector<coord_t> m_centres;
+};
 } // namespace
 
 // Register the algorithm into the AlgorithmFactory
@@ -263,28 +335,48 @@ void FindPeaksMD::determineOutputType(const std::string &peakType, const uint16_
 }
 
 //----------------------------------------------------------------------------------------------
-/** Create and add a Peak to the output workspace
+/** Create a Peak to be added to the output workspace by addPeaksOnDetectors
  *
- * @param compInfo :: ComponentInfo object to use for edge pixel checking
  * @param Q :: Q_lab or Q_sample, depending on workspace
  * @param binCount :: bin count to give to the peak.
- * @param tracer :: Ray tracer to use for detector finding
+ * @param peaks :: the peaks whose detectors are still to be found
  */
-void FindPeaksMD::addPeak(const Geometry::ComponentInfo &compInfo, const V3D &Q, const double binCount,
-                          const Geometry::InstrumentRayTracer &tracer) {
+void FindPeaksMD::addPeak(const V3D &Q, const double binCount, std::vector<std::shared_ptr<DataObjects::Peak>> &peaks) {
   try {
-    auto p = this->createPeak(Q, binCount, tracer);
-    if (m_edge > 0) {
-      if (edgePixel(compInfo, p->getBankName(), p->getCol(), p->getRow(), m_edge))
-        return;
-    }
-    if (p->getDetectorID() != -1)
-      peakWS->addPeak(*p);
+    peaks.emplace_back(this->createPeak(Q, binCount));
   } catch (std::exception &e) {
     g_log.notice() << "Error creating peak at " << Q << " because of '" << e.what() << "'. Peak will be skipped.\n";
   }
 }
 
+/** Find the detectors of the peaks of one experiment info, tracing them all
+ * in one batch, and add the peaks that hit a detector to the output workspace
+ *
+ * @param ei :: the experiment info the peaks were created from
+ * @param peaks :: the peaks, in the order they are to be added
+ */
+void FindPeaksMD::addPeaksOnDetectors(const ExperimentInfo &ei,
+                                      const std::vector<std::shared_ptr<DataObjects::Peak>> &peaks) {
+  if (peaks.empty())
+    return;
+  const auto &compInfo = ei.componentInfo();
+  const Geometry::DetectorBoundingVolumeHierarchy hierarchy(compInfo, ei.detectorInfo());
+  std::vector<Peak *> peakPtrs;
+  peakPtrs.reserve(peaks.size());
+  std::transform(peaks.cbegin(), peaks.cend(), std::back_inserter(peakPtrs), [](const auto &p) { return p.get(); });
+  const auto found = Peak::findDetectors(peakPtrs, hierarchy);
+
+  for (size_t i = 0; i < peaks.size(); ++i) {
+    const auto &p = peaks[i];
+    if (!found[i])
+      continue;
+    if (m_edge > 0 && edgePixel(compInfo, p->getBankName(), p->getCol(), p->getRow(), m_edge))
+      continue;
+    peakWS->addPeak(*p);
+    g_log.information() << "Add new peak with Q-center = " << p->getQLabFrame() << " in the lab frame\n";
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Create and add a LeanElasticPeak to the output workspace
  *
@@ -301,12 +393,13 @@ void FindPeaksMD::addLeanElasticPeak(const V3D &Q, const double binCount, const
 /**
  * Creates a Peak object from Q & bin count
  * */
-std::shared_ptr<DataObjects::Peak> FindPeaksMD::createPeak(const Mantid::Kernel::V3D &Q, const double binCount,
-                                                           const Geometry::InstrumentRayTracer &tracer) {
+std::shared_ptr<DataObjects::Peak> FindPeaksMD::createPeak(const Mantid::Kernel::V3D &Q, const double binCount) {
+  // The peak is placed along its direction from the sample until addPeaksOnDetectors finds its detector
+  const std::optional<double> detectorDistance(1.0);
   std::shared_ptr<DataObjects::Peak> p;
   if (dimType == QLAB) {
     // Build using the Q-lab-frame constructor
-    p = std::make_shared<Peak>(m_inst, Q);
+    p = std::make_shared<Peak>(m_inst, Q, detectorDistance);
     // Save gonio matrix for later
     p->setGoniometerMatrix(m_goniometer);
   } else if (dimType == QSAMPLE) {
@@ -331,20 +424,15 @@ std::shared_ptr<DataObjects::Peak> FindPeaksMD::createPeak(const Mantid::Kernel:
       std::vector<double> angles = goniometer.getEulerAngles("YZY");
       g_log.information() << "Found goniometer rotation to be in YZY convention [" << angles[0] << ", " << angles[1]
                           << ". " << angles[2] << "] degrees for Q sample = " << Q << "\n";
-      p = std::make_shared<Peak>(m_inst, Q, goniometer.getR());
+      p = std::make_shared<Peak>(m_inst, Q, goniometer.getR(), detectorDistance);
 
     } else {
-      p = std::make_shared<Peak>(m_inst, Q, m_goniometer);
+      p = std::make_shared<Peak>(m_inst, Q, m_goniometer, detectorDistance);
     }
   } else {
     throw std::invalid_argument("Cannot Integrate peaks unless the dimension is QLAB or QSAMPLE");
   }
 
-  try { // Look for a detector
-    p->findDetector(tracer);
-  } catch (...) { /* Ignore errors in ray-tracer */
-  }
-
   p->setBinCount(binCount);
   // Save the run number found before.
   p->setRunNumber(m_runNumber);
@@ -420,22 +508,23 @@ template <typename MDE, size_t nd> void FindPeaksMD::findPeaks(typename MDEventW
   // This pair is the <density, ptr to the box>
   using dens_box = std::pair<double, API::IMDNode *>;
 
-  // Map that will sort the boxes by increasing density. The key = density;
-  // value = box *.
-  typename std::multimap<double, API::IMDNode *> sortedBoxes;
-
   // --------------- Sort and Filter by Density -----------------------------
   progress(0.20, "Sorting Boxes by Density");
-  auto it1 = boxes.begin();
-  auto it1_end = boxes.end();
-  for (; it1 != it1_end; it1++) {
-    auto box = *it1;
+  std::vector<double> densities(boxes.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < static_cast<int64_t>(boxes.size()); i++) {
+    auto box = boxes[i];
     double value = m_useNumberOfEventsNormalization ? box->getSignalByNEvents() : box->getSignalNormalized();
-    value *= m_densityScaleFactor;
-    // Skip any boxes with too small a signal value.
-    if (value > threshold)
-      sortedBoxes.insert(dens_box(value, box));
+    densities[i] = value * m_densityScaleFactor;
+  }
+  // Boxes sorted by increasing density, skipping any with too small a signal value.
+  std::vector<dens_box> sortedBoxes;
+  for (size_t i = 0; i < boxes.size(); i++) {
+    if (densities[i] > threshold)
+      sortedBoxes.emplace_back(densities[i], boxes[i]);
   }
+  std::stable_sort(sortedBoxes.begin(), sortedBoxes.end(),
+                   [](const dens_box &a, const dens_box &b) { return a.first < b.first; });
 
   // --------------- Find Peak Boxes -----------------------------
   // List of chosen possible peak boxes.
@@ -447,11 +536,12 @@ template <typename MDE, size_t nd> void FindPeaksMD::findPeaks(typename MDEventW
   bool isMDEvent(ws->id().find("MDEventWorkspace") != std::string::npos);
 
   int64_t numBoxesFound = 0;
-  // Now we go (backwards) through the map
+  // Centres of the boxes already picked
+  PeakCentreGrid peakCentres(nd, peakRadiusSquared);
+  // Now we go (backwards) through the sorted boxes
   // e.g. from highest density down to lowest density.
-  typename std::multimap<double, boxPtr>::reverse_iterator it2;
-  auto it2_end = sortedBoxes.rend();
-  for (it2 = sortedBoxes.rbegin(); it2 != it2_end; ++it2) {
+  auto it2_end = sortedBoxes.crend();
+  for (auto it2 = sortedBoxes.crbegin(); it2 != it2_end; ++it2) {
     signal_t density = it2->first;
     boxPtr box = it2->second;
 #ifndef MDBOX_TRACK_CENTROID
@@ -461,30 +551,8 @@ template <typename MDE, size_t nd> void FindPeaksMD::findPeaks(typename MDEventW
     const coord_t *boxCenter = box->getCentroid();
 #endif
 
-    // Compare to all boxes already picked.
-    bool badBox = false;
-    for (auto &peakBoxe : peakBoxes) {
-
-#ifndef MDBOX_TRACK_CENTROID
-      coord_t otherCenter[nd];
-      (*it3)->calculateCentroid(otherCenter);
-#else
-      const coord_t *otherCenter = peakBoxe->getCentroid();
-#endif
-
-      // Distance between this box and a box we already put in.
-      coord_t distSquared = 0.0;
-      for (size_t d = 0; d < nd; d++) {
-        coord_t dist = otherCenter[d] - boxCenter[d];
-        distSquared += (dist * dist);
-      }
-
-      // Reject this box if it is too close to another previously found box.
-      if (distSquared < peakRadiusSquared) {
-        badBox = true;
-        break;
-      }
-    }
+    // Reject this box if it is too close to another previously found box.
+    bool badBox = peakCentres.hasNeighbour(boxCenter);
 
     // The box was not rejected for another reason.
     if (!badBox) {
@@ -494,6 +562,7 @@ template <typename MDE, size_t nd> void FindPeaksMD::findPeaks(typename MDEventW
       }
 
       peakBoxes.emplace_back(box);
+      peakCentres.add(boxCenter);
       g_log.debug() << "Found box at ";
       for (size_t d = 0; d < nd; d++)
         g_log.debug() << (d > 0 ? "," : "") << boxCenter[d];
@@ -538,12 +607,11 @@ template <typename MDE, size_t nd> void FindPeaksMD::findPeaks(typename MDEventW
       ExperimentInfo_sptr ei = ws->getExperimentInfo(iexp);
       this->readExperimentInfo(ei);
 
-      Geometry::InstrumentRayTracer tracer(m_inst);
-      Geometry::ComponentInfo const &compInfo = ei->componentInfo();
       // Copy the instrument, sample, run to the peaks workspace.
       peakWS->copyExperimentInfoFrom(ei.get());
 
       // --- Convert the "boxes" to peaks ----
+      std::vector<std::shared_ptr<DataObjects::Peak>> peaks;
       for (auto box : peakBoxes) {
         //  If no events from this experimental contribute to the box then skip
         if (numExperimentInfo > 1) {
@@ -592,7 +660,7 @@ template <typename MDE, size_t nd> void FindPeaksMD::findPeaks(typename MDEventW
           addLeanElasticPeak(Q, binCount, true);
         } else {
           try {
-            auto p = this->createPeak(Q, binCount, tracer);
+            auto p = this->createPeak(Q, binCount);
             if (m_addDetectors) {
               auto mdBox = dynamic_cast<MDBoxBase<MDE, nd> *>(box);
               if (!mdBox) {
@@ -600,16 +668,7 @@ template <typename MDE, size_t nd> void FindPeaksMD::findPeaks(typename MDEventW
               }
               addDetectors(*p, *mdBox);
             }
-            if (p->getDetectorID() != -1) {
-              if (m_edge > 0) {
-                if (!edgePixel(compInfo, p->getBankName(), p->getCol(), p->getRow(), m_edge))
-                  peakWS->addPeak(*p);
-                ;
-              } else {
-                peakWS->addPeak(*p);
-              }
-              g_log.information() << "Add new peak with Q-center = " << Q[0] << ", " << Q[1] << ", " << Q[2] << "\n";
-            }
+            peaks.emplace_back(std::move(p));
           } catch (std::exception &e) {
             g_log.notice() << "Error creating peak at " << Q << " because of '" << e.what()
                            << "'. Peak will be skipped.\n";
@@ -620,6 +679,7 @@ template <typename MDE, size_t nd> void FindPeaksMD::findPeaks(typename MDEventW
         prog->report("Adding Peaks");
 
       } // for each box found
+      addPeaksOnDetectors(*ei, peaks);
     }
   }
   g_log.notice() << "Number of peaks found: " << peakWS->getNumberPeaks() << '\n';
@@ -641,9 +701,8 @@ void FindPeaksMD::findPeaksHisto(const Mantid::DataObjects::MDHistoWorkspace_spt
   // This pair is the <density, box index>
   using dens_box = std::pair<double, size_t>;
 
-  // Map that will sort the boxes by increasing density. The key = density;
-  // value = box index.
-  std::multimap<double, size_t> sortedBoxes;
+  // Boxes sorted by increasing density
+  std::vector<dens_box> sortedBoxes;
 
   size_t numBoxes = ws->getNPoints();
 
@@ -668,8 +727,10 @@ void FindPeaksMD::findPeaksHisto(const Mantid::DataObjects::MDHistoWorkspace_spt
     double density = ws->getSignalNormalizedAt(i) * m_densityScaleFactor;
     // Skip any boxes with too small a signal density.
     if (density > thresholdDensity)
-      sortedBoxes.insert(dens_box(density, i));
+      sortedBoxes.emplace_back(density, i);
   }
+  std::stable_sort(sortedBoxes.begin(), sortedBoxes.end(),
+                   [](const dens_box &a, const dens_box &b) { return a.first < b.first; });
 
   // --------------- Find Peak Boxes -----------------------------
   // List of chosen possible peak boxes.
@@ -678,34 +739,22 @@ void FindPeaksMD::findPeaksHisto(const Mantid::DataObjects::MDHistoWorkspace_spt
   prog = std::make_unique<Progress>(this, 0.30, 0.95, m_maxPeaks);
 
   int64_t numBoxesFound = 0;
-  // Now we go (backwards) through the map
+  // Centres of the boxes already picked
+  PeakCentreGrid peakCentres(nd, peakRadiusSquared);
+  std::vector<coord_t> boxCenter(nd);
+  // Now we go (backwards) through the sorted boxes
   // e.g. from highest density down to lowest density.
-  std::multimap<double, size_t>::reverse_iterator it2;
-  auto it2_end = sortedBoxes.rend();
-  for (it2 = sortedBoxes.rbegin(); it2 != it2_end; ++it2) {
+  auto it2_end = sortedBoxes.crend();
+  for (auto it2 = sortedBoxes.crbegin(); it2 != it2_end; ++it2) {
     signal_t density = it2->first;
     size_t index = it2->second;
     // Get the center of the box
-    VMD boxCenter = ws->getCenter(index);
-
-    // Compare to all boxes already picked.
-    bool badBox = false;
-    for (auto &peakBoxe : peakBoxes) {
-      VMD otherCenter = ws->getCenter(peakBoxe);
-
-      // Distance between this box and a box we already put in.
-      coord_t distSquared = 0.0;
-      for (size_t d = 0; d < nd; d++) {
-        coord_t dist = otherCenter[d] - boxCenter[d];
-        distSquared += (dist * dist);
-      }
+    const VMD center = ws->getCenter(index);
+    for (size_t d = 0; d < nd; d++)
+      boxCenter[d] = static_cast<coord_t>(center[d]);
 
-      // Reject this box if it is too close to another previously found box.
-      if (distSquared < peakRadiusSquared) {
-        badBox = true;
-        break;
-      }
-    }
+    // Reject this box if it is too close to another previously found box.
+    bool badBox = peakCentres.hasNeighbour(boxCenter.data());
 
     // The box was not rejected for another reason.
     if (!badBox) {
@@ -715,6 +764,7 @@ void FindPeaksMD::findPeaksHisto(const Mantid::DataObjects::MDHistoWorkspace_spt
       }
 
       peakBoxes.emplace_back(index);
+      peakCentres.add(boxCenter.data());
       g_log.debug() << "Found box at index " << index;
       g_log.debug() << "; Density = " << density << '\n';
       // Report progres for each box found.
@@ -745,13 +795,12 @@ void FindPeaksMD::findPeaksHisto(const Mantid::DataObjects::MDHistoWorkspace_spt
     for (uint16_t iexp = 0; iexp < ws->getNumExperimentInfo(); iexp++) {
       ExperimentInfo_sptr ei = ws->getExperimentInfo(iexp);
       this->readExperimentInfo(ei);
-      Geometry::InstrumentRayTracer tracer(m_inst);
-      Geometry::ComponentInfo const &compInfo = ei->componentInfo();
 
       // Copy the instrument, sample, run to the peaks workspace.
       peakWS->copyExperimentInfoFrom(ei.get());
 
       // --- Convert the "boxes" to peaks ----
+      std::vector<std::shared_ptr<DataObjects::Peak>> peaks;
       for (auto index : peakBoxes) {
         // The center of the box = Q in the lab frame
         VMD boxCenter = ws->getCenter(index);
@@ -766,12 +815,13 @@ void FindPeaksMD::findPeaksHisto(const Mantid::DataObjects::MDHistoWorkspace_spt
         if (m_leanElasticPeak)
           addLeanElasticPeak(Q, binCount, true);
         else
-          addPeak(compInfo, Q, binCount, tracer);
+          addPeak(Q, binCount, peaks);
 
         // Report progres for each box found.
         prog->report("Adding Peaks");
 
       } // for each box found
+      addPeaksOnDetectors(*ei, peaks);
     }
   }
   g_log.notice() << "Number of peaks found: " << peakWS->getNumberPeaks() << '\n';
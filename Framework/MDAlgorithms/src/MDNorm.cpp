@@ -524,12 +524,7 @@ void MDNorm::exec() {
     cacheDimensionXValues();
 
     if (!skipNormalization) {
-      size_t symmOpsIndex = 0;
-      for (const auto &so : symmetryOps) {
-        calculateNormalization(otherValues, so, expInfoIndex, symmOpsIndex);
-        symmOpsIndex++;
-      }
-
+      calculateNormalization(otherValues, symmetryOps, expInfoIndex);
     } else {
       g_log.warning("Binning limits are outside the limits of the MDWorkspace. "
                     "Not applying normalization.");
@@ -1457,14 +1452,15 @@ inline void MDNorm::calcSingleDetectorNorm(const std::vector<std::array<double,
 
 /**
  * Computed the normalization for the input workspace. Results are stored in
- * m_normWS
+ * m_normWS. Each detector is visited once for all the symmetry operations, so
+ * its angles, solid angle and flux spectrum are only looked up once.
  * @param otherValues - values for dimensions other than Q or DeltaE
- * @param so - symmetry operation
+ * @param symmetryOps - symmetry operations
  * @param expInfoIndex - current experiment info index
- * @param soIndex - the index of symmetry operation (for progress purposes only)
  */
-void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues, const Geometry::SymmetryOperation &so,
-                                    uint16_t expInfoIndex, size_t soIndex) {
+void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues,
+                                    const std::vector<Geometry::SymmetryOperation> &symmetryOps,
+                                    uint16_t expInfoIndex) {
   const auto &currentExptInfo = *(m_inputWS->getExperimentInfo(expInfoIndex));
   std::vector<double> lowValues, highValues;
   auto *lowValuesLog = dynamic_cast<VectorDoubleProperty *>(currentExptInfo.getLog("MDNorm_low"));
@@ -1472,9 +1468,12 @@ void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues, con
   auto *highValuesLog = dynamic_cast<VectorDoubleProperty *>(currentExptInfo.getLog("MDNorm_high"));
   highValues = (*highValuesLog)();
 
-  // calculate Q transformation matrix (R * UB * SymmetryOperation * m_W)^-1
+  // calculate Q transformation matrices (R * UB * SymmetryOperation * m_W)^-1
   // in order to calculate intersections
-  DblMatrix Qtransform = calQTransform(currentExptInfo, so);
+  std::vector<DblMatrix> Qtransforms;
+  Qtransforms.reserve(symmetryOps.size());
+  std::transform(symmetryOps.cbegin(), symmetryOps.cend(), std::back_inserter(Qtransforms),
+                 [this, &currentExptInfo](const auto &so) { return calQTransform(currentExptInfo, so); });
 
   // get proton charges
   const double protonCharge = currentExptInfo.run().getProtonCharge();
@@ -1512,8 +1511,8 @@ void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues, con
   std::vector<coord_t> pos, posNew;
 
   // Progress report
-  double progStep = 0.7 / static_cast<double>(m_numExptInfos * m_numSymmOps);
-  auto progIndex = static_cast<double>(soIndex + expInfoIndex * m_numSymmOps);
+  double progStep = 0.7 / static_cast<double>(m_numExptInfos);
+  auto progIndex = static_cast<double>(expInfoIndex);
   auto prog =
       std::make_unique<API::Progress>(this, 0.3 + progStep * progIndex, 0.3 + progStep * (1. + progIndex), ndets);
   // muliple threading
@@ -1545,13 +1544,6 @@ for (int64_t i = 0; i < ndets; i++) {
     }
   }
 
-  // Intersections for sample and background if present
-  this->calculateIntersections(intersections, theta, phi, Qtransform, lowValues[i], highValues[i]);
-
-  // No need to do normalization calculation if there is no intersection
-  if (intersections.empty())
-    continue;
-
   // Get solid angle for this contribution
   double solid = protonCharge;
   // [Task 89]
@@ -1564,18 +1556,27 @@ for (int64_t i = 0; i < ndets; i++) {
     bkgdSolid = solid_angle_factor * protonChargeBkgd;
   }
 
-  if (m_diffraction) {
-    // -- calculate integrals for the intersection --
-    calcDiffractionIntersectionIntegral(intersections, xValues, yValues, *integrFlux, wsIdx);
-  }
-
   // Compute final position in HKL
   // pre-allocate for efficiency and copy non-hkl dim values into place
   pos.resize(vmdDims + otherValues.size());
   std::copy(otherValues.begin(), otherValues.end(), pos.begin() + vmdDims);
 
-  calcSingleDetectorNorm(intersections, solid, yValues, vmdDims, pos, posNew, signalArray, bkgdSolid,
-                         bkgdSignalArray); // [Task 89] ADD solidBkgd, bkgdYValues, bkgdSignalArray
+  for (const auto &Qtransform : Qtransforms) {
+    // Intersections for sample and background if present
+    this->calculateIntersections(intersections, theta, phi, Qtransform, lowValues[i], highValues[i]);
+
+    // No need to do normalization calculation if there is no intersection
+    if (intersections.empty())
+      continue;
+
+    if (m_diffraction) {
+      // -- calculate integrals for the intersection --
+      calcDiffractionIntersectionIntegral(intersections, xValues, yValues, *integrFlux, wsIdx);
+    }
+
+    calcSingleDetectorNorm(intersections, solid, yValues, vmdDims, pos, posNew, signalArray, bkgdSolid,
+                           bkgdSignalArray); // [Task 89] ADD solidBkgd, bkgdYValues, bkgdSignalArray
+  }
 
   prog->report();
 
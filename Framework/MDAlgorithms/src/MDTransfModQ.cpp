@@ -7,6 +7,9 @@
 #include "MantidMDAlgorithms/MDTransfModQ.h"
 #include "MantidKernel/RegistrationHelper.h"
 #include "MantidMDAlgorithms/DisplayNormalizationSetter.h"
+
+#include <algorithm>
+
 namespace Mantid::MDAlgorithms {
 // register the class, whith conversion factory under ModQ name
 // clang-format off
@@ -84,6 +87,140 @@ bool MDTransfModQ::calcMatrixCoord(const double &deltaEOrK0, std::vector<coord_t
   }
 }
 
+/**Convert all points of a spectrum of matrix workspace into reciprocal space.
+The coordinates of all points are calculated in one loop without branching, so
+that the compiler can vectorize it, and the points within the range requested
+are then appended to the output coordinates.
+@param X -- In elastic the moduli of K0, in inelastic the energy transfers
+@param Coord -- MD coordinates with the generic and detector-dependent values
+set, used as the template for the coordinates of every point
+@param signal -- the signals in the points. Not changed by this method.
+@param errSq -- the squared errors in the points. Not changed by this method.
+@param allCoord -- the coordinates of the points within the range are
+appended to this vector
+@param accepted -- set to 1 for the points within the range and to 0 otherwise
+
+@return the number of points within the range
+*/
+size_t MDTransfModQ::calcMatrixCoords(const std::vector<double> &X, std::vector<coord_t> &Coord,
+                                      std::vector<double> &signal, std::vector<double> &errSq,
+                                      std::vector<coord_t> &allCoord, std::vector<char> &accepted) const {
+  UNUSED_ARG(signal);
+  UNUSED_ARG(errSq);
+  const size_t nPoints = X.size();
+  std::vector<coord_t> matrixCoord(m_NMatrixDim * nPoints);
+  std::vector<double> qSq(nPoints);
+  accepted.resize(nPoints);
+
+  // local copies, so the compiler knows that writing the results does not change them
+  const double *const x = X.data();
+  double *const modQSq = qSq.data();
+  char *const inRange = accepted.data();
+  const double ex(m_ex), ey(m_ey), ez(m_ez);
+  const double r0(m_RotMat[0]), r1(m_RotMat[1]), r2(m_RotMat[2]), r3(m_RotMat[3]), r4(m_RotMat[4]),
+      r5(m_RotMat[5]), r6(m_RotMat[6]), r7(m_RotMat[7]), r8(m_RotMat[8]);
+  const double qSqMin(m_DimMin[0]), qSqMax(m_DimMax[0]);
+
+  if (m_Emode == Kernel::DeltaEMode::Elastic) {
+    for (size_t i = 0; i < nPoints; ++i) {
+      const double qx = -ex * x[i];
+      const double qy = -ey * x[i];
+      const double qz = (1 - ez) * x[i];
+      const double Qx = (r0 * qx + r1 * qy + r2 * qz);
+      const double Qy = (r3 * qx + r4 * qy + r5 * qz);
+      const double Qz = (r6 * qx + r7 * qy + r8 * qz);
+      modQSq[i] = Qx * Qx + Qy * Qy + Qz * Qz;
+    }
+  } else {
+    std::vector<double> kPerpendicular, qAlongBeam;
+    calcInelasticWaveVectors(X, kPerpendicular, qAlongBeam);
+
+    const double *const kOut = kPerpendicular.data();
+    const double *const qBeam = qAlongBeam.data();
+    for (size_t i = 0; i < nPoints; ++i) {
+      const double qx = -ex * kOut[i];
+      const double qy = -ey * kOut[i];
+      const double qz = qBeam[i];
+      const double Qx = (r0 * qx + r1 * qy + r2 * qz);
+      const double Qy = (r3 * qx + r4 * qy + r5 * qz);
+      const double Qz = (r6 * qx + r7 * qy + r8 * qz);
+      modQSq[i] = Qx * Qx + Qy * Qy + Qz * Qz;
+    }
+    std::transform(X.cbegin(), X.cend(), matrixCoord.begin() + nPoints,
+                   [](const double deltaE) { return static_cast<coord_t>(deltaE); });
+  }
+
+  // the checks of the limits are left to this loop, which can not be vectorized because of sqrt anyway
+  coord_t *const modQ = matrixCoord.data();
+  const double eMin(m_NMatrixDim > 1 ? m_DimMin[1] : 0.), eMax(m_NMatrixDim > 1 ? m_DimMax[1] : 0.);
+  for (size_t i = 0; i < nPoints; ++i) {
+    inRange[i] = !(modQSq[i] < qSqMin || modQSq[i] >= qSqMax);
+    if (m_NMatrixDim > 1 && (x[i] < eMin || x[i] >= eMax))
+      inRange[i] = 0;
+    modQ[i] = static_cast<coord_t>(sqrt(modQSq[i]));
+  }
+  return appendAcceptedCoords(matrixCoord, Coord, accepted, allCoord);
+}
+
+/** Calculate, for every point in an inelastic mode, the wave vector of the
+neutrons which is not fixed, final in direct and initial in indirect mode, as
+the component of the momentum transfer perpendicular to the beam and the one
+along it, before the rotation to the crystal frame. Kept out of the loops over
+the components of Q as sqrt reports domain errors, which stops the compiler
+vectorizing the loop it is in.
+@param X -- the energy transfers of the points
+@param kPerpendicular -- set to the wave vector giving the component of the
+momentum transfer perpendicular to the beam, in units of the detector direction
+@param qAlongBeam -- set to the component of the momentum transfer along the
+beam
+*/
+void MDTransfModQ::calcInelasticWaveVectors(const std::vector<double> &X, std::vector<double> &kPerpendicular,
+                                            std::vector<double> &qAlongBeam) const {
+  const size_t nPoints = X.size();
+  kPerpendicular.resize(nPoints);
+  qAlongBeam.resize(nPoints);
+  const double *const x = X.data();
+  const double ez(m_ez);
+  if (m_Emode == Kernel::DeltaEMode::Direct) {
+    for (size_t i = 0; i < nPoints; ++i) {
+      const double kFinal = sqrt((m_eFixed - x[i]) / PhysicalConstants::E_mev_toNeutronWavenumberSq);
+      kPerpendicular[i] = kFinal;
+      qAlongBeam[i] = m_kFixed - ez * kFinal;
+    }
+  } else {
+    for (size_t i = 0; i < nPoints; ++i) {
+      const double kInitial = sqrt((m_eFixed + x[i]) / PhysicalConstants::E_mev_toNeutronWavenumberSq);
+      kPerpendicular[i] = m_kFixed;
+      qAlongBeam[i] = kInitial - ez * m_kFixed;
+    }
+  }
+}
+
+/** Append the MD coordinates of the accepted points to the output coordinates
+@param matrixCoord -- the coordinates calculated from the matrix workspace, all
+points of the first dimension followed by all points of the next one
+@param Coord -- MD coordinates with the remaining values set, used as the
+template for the coordinates of every point
+@param accepted -- 1 for the points to append and 0 otherwise
+@param allCoord -- the vector to append the coordinates to
+
+@return the number of points appended
+*/
+size_t MDTransfModQ::appendAcceptedCoords(const std::vector<coord_t> &matrixCoord, std::vector<coord_t> &Coord,
+                                          const std::vector<char> &accepted, std::vector<coord_t> &allCoord) const {
+  const size_t nPoints = accepted.size();
+  size_t nAccepted(0);
+  for (size_t i = 0; i < nPoints; ++i) {
+    if (!accepted[i])
+      continue;
+    for (size_t j = 0; j < m_NMatrixDim; ++j)
+      Coord[j] = matrixCoord[j * nPoints + i];
+    allCoord.insert(allCoord.end(), Coord.begin(), Coord.end());
+    ++nAccepted;
+  }
+  return nAccepted;
+}
+
 /** Method fills-in all additional properties requested by user and not defined
  *by matrix workspace itself.
  *  it fills in [nd - (1 or 2 -- depending on emode)] values into Coord vector;
@@ -8,10 +8,25 @@
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/RegistrationHelper.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace Mantid::MDAlgorithms {
 // register the class, whith conversion factory under Q3D name
 DECLARE_MD_TRANSFID(MDTransfQ3D, Q3D)
 
+namespace {
+/// The smallest coord_t which is not below the limit given. A coord_t is below the result if and only if it is
+/// below the limit itself.
+coord_t coordLimit(const double limit) {
+  auto rounded = static_cast<coord_t>(limit);
+  if (rounded < limit)
+    rounded = std::nextafter(rounded, std::numeric_limits<coord_t>::infinity());
+  return rounded;
+}
+} // namespace
+
 /** method returns number of matrix dimensions calculated by this class
  * as function of energy analysis mode   */
 unsigned int MDTransfQ3D::getNMatrixDimensions(Kernel::DeltaEMode::Type mode,
@@ -52,6 +67,110 @@ bool MDTransfQ3D::calcMatrixCoord(const double &deltaEOrK0, std::vector<coord_t>
   }
 }
 
+/** Calculates 3D transformation of all values of a spectrum and (if applicable)
+  signals and errors depending on 3D coordinates (e.g. Lorentz corrections).
+  The coordinates of all values are calculated in one loop without branching,
+  so that the compiler can vectorize it, and the values within the range
+  requested are then appended to the output coordinates.
+  *@param X -- In elastic the moduli of K0, in inelastic the energy transfers
+  *@param Coord -- MD coordinates with the generic values set, used as the
+  template for the coordinates of every value
+  *@param signal -- the signals, Lorentz corrected if requested
+  *@param errSq -- the squared errors, Lorentz corrected if requested
+  *@param allCoord -- the coordinates of the values within the range are
+  appended to this vector
+  *@param accepted -- set to 1 for the values within the range and to 0
+  otherwise
+
+  *@return the number of values within the range
+*/
+size_t MDTransfQ3D::calcMatrixCoords(const std::vector<double> &X, std::vector<coord_t> &Coord,
+                                     std::vector<double> &signal, std::vector<double> &errSq,
+                                     std::vector<coord_t> &allCoord, std::vector<char> &accepted) const {
+  const size_t nPoints = X.size();
+  std::vector<coord_t> matrixCoord(m_NMatrixDim * nPoints);
+  accepted.resize(nPoints);
+
+  // local copies, so the compiler knows that writing the results does not change them
+  const double *const x = X.data();
+  coord_t *const q1 = matrixCoord.data();
+  coord_t *const q2 = q1 + nPoints;
+  coord_t *const q3 = q2 + nPoints;
+  char *const inRange = accepted.data();
+  const double sign = convention == "Crystallography" ? -1. : 1.;
+  const double ex(m_ex), ey(m_ey), ez(m_ez);
+  const double r0(m_RotMat[0]), r1(m_RotMat[1]), r2(m_RotMat[2]), r3(m_RotMat[3]), r4(m_RotMat[4]),
+      r5(m_RotMat[5]), r6(m_RotMat[6]), r7(m_RotMat[7]), r8(m_RotMat[8]);
+
+  if (m_Emode == Kernel::DeltaEMode::Elastic) {
+    // Dimension limits have to be converted to coord_t, otherwise floating point
+    // error will cause valid events to be discarded.
+    const auto min0(static_cast<coord_t>(m_DimMin[0])), min1(static_cast<coord_t>(m_DimMin[1])),
+        min2(static_cast<coord_t>(m_DimMin[2]));
+    const auto max0(static_cast<coord_t>(m_DimMax[0])), max1(static_cast<coord_t>(m_DimMax[1])),
+        max2(static_cast<coord_t>(m_DimMax[2]));
+    for (size_t i = 0; i < nPoints; ++i) {
+      const double qx = sign * (-ex * x[i]);
+      const double qy = sign * (-ey * x[i]);
+      const double qz = sign * ((1 - ez) * x[i]);
+      const auto c1 = static_cast<coord_t>(r0 * qx + r1 * qy + r2 * qz);
+      const auto c2 = static_cast<coord_t>(r3 * qx + r4 * qy + r5 * qz);
+      const auto c3 = static_cast<coord_t>(r6 * qx + r7 * qy + r8 * qz);
+      inRange[i] = !((c1 < min0) | (c1 >= max0) | (c2 < min1) | (c2 >= max1) | (c3 < min2) | (c3 >= max2));
+      q1[i] = c1;
+      q2[i] = c2;
+      q3[i] = c3;
+    }
+    /*Apply Lorentz corrections if necessary */
+    if (m_isLorentzCorrected) {
+      const double sinThetaSq(m_SinThetaSq);
+      double *const s = signal.data();
+      double *const err = errSq.data();
+      for (size_t i = 0; i < nPoints; ++i) {
+        const double kdash = x[i] / (2 * M_PI);
+        const double correct = sinThetaSq * kdash * kdash * kdash * kdash;
+        s[i] *= correct;
+        err[i] *= (correct * correct);
+      }
+    }
+  } else {
+    std::vector<double> kPerpendicular, qAlongBeam;
+    calcInelasticWaveVectors(X, kPerpendicular, qAlongBeam);
+
+    const double *const kOut = kPerpendicular.data();
+    const double *const qBeam = qAlongBeam.data();
+    // comparing the coordinates with the limits converted by coordLimit gives the same results as with the limits
+    // themselves and keeps the comparisons in coord_t
+    const coord_t min0(coordLimit(m_DimMin[0])), min1(coordLimit(m_DimMin[1])), min2(coordLimit(m_DimMin[2])),
+        min3(coordLimit(m_DimMin[3]));
+    const coord_t max0(coordLimit(m_DimMax[0])), max1(coordLimit(m_DimMax[1])), max2(coordLimit(m_DimMax[2])),
+        max3(coordLimit(m_DimMax[3]));
+    for (size_t i = 0; i < nPoints; ++i) {
+      const double qx = sign * (-ex * kOut[i]);
+      const double qy = sign * (-ey * kOut[i]);
+      const double qz = sign * qBeam[i];
+      q1[i] = static_cast<coord_t>(r0 * qx + r1 * qy + r2 * qz);
+      q2[i] = static_cast<coord_t>(r3 * qx + r4 * qy + r5 * qz);
+      q3[i] = static_cast<coord_t>(r6 * qx + r7 * qy + r8 * qz);
+    }
+    for (size_t i = 0; i < nPoints; ++i) {
+      const auto dE = static_cast<coord_t>(x[i]);
+      inRange[i] = !((dE < min3) | (dE >= max3) | (q1[i] < min0) | (q1[i] >= max0) | (q2[i] < min1) |
+                     (q2[i] >= max1) | (q3[i] < min2) | (q3[i] >= max2));
+    }
+    std::transform(X.cbegin(), X.cend(), q3 + nPoints,
+                   [](const double deltaE) { return static_cast<coord_t>(deltaE); });
+  }
+
+  // the hole near the origin of Q; the modulus of Q can never be below a limit which is not positive
+  if (m_AbsMin > 0) {
+    for (size_t i = 0; i < nPoints; ++i)
+      if (std::sqrt(q1[i] * q1[i] + q2[i] * q2[i] + q3[i] * q3[i]) < m_AbsMin)
+        inRange[i] = 0;
+  }
+  return appendAcceptedCoords(matrixCoord, Coord, accepted, allCoord);
+}
+
 /** method calculates workspace-dependent coordinates in inelastic case.
 * Namely, it calculates module of Momentum transfer and the Energy
 * transfer and put them into initial positions (0 and 1) in the Coord vector
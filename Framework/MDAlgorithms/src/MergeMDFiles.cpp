@@ -12,12 +12,15 @@
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidDataObjects/MDEventWorkspace.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/VectorHelper.h"
 #include "MantidNexus/NexusFile.h"
 
 #include <boost/scoped_ptr.hpp>
+#include <algorithm>
 #include <filesystem>
+#include <iterator>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
@@ -187,8 +190,8 @@ void MergeMDFiles::doExecByCloning(const Mantid::API::IMDEventWorkspace_sptr &ws
   m_OutIWS = ws;
   m_MDEventType = ws->getEventTypeName();
 
-  // Run the tasks in parallel? TODO: enable
-  // bool Parallel = this->getProperty("Parallel");
+  // Merge several boxes at once, reading from the input files concurrently
+  const bool parallel = this->getProperty("Parallel");
 
   // Fix the box controller settings in the output workspace so that it splits
   // normally
@@ -220,19 +223,9 @@ void MergeMDFiles::doExecByCloning(const Mantid::API::IMDEventWorkspace_sptr &ws
   this->loadBoxData();
 
   size_t numBoxes = m_BoxStruct.getNBoxes();
-  // Progress report based on events processed.
-  m_progress = std::make_unique<Progress>(this, 0.1, 0.9, size_t(numBoxes));
-  m_progress->setNotifyStep(0.1);
-
-  // For tracking progress
-  // uint64_t m_totalEventsInTasks = 0;
 
-  // Prepare thread pool
   CPUTimer overallTime;
 
-  auto ts = new ThreadSchedulerFIFO();
-  ThreadPool tp(ts);
-
   Kernel::DiskBuffer *DiskBuf(nullptr);
   if (m_fileBasedTargetWS) {
     DiskBuf = bc->getFileIO();
@@ -240,49 +233,46 @@ void MergeMDFiles::doExecByCloning(const Mantid::API::IMDEventWorkspace_sptr &ws
 
   this->m_totalLoaded = 0;
   const std::vector<API::IMDNode *> &boxes = m_BoxStruct.getBoxes();
+  std::vector<API::IMDNode *> leafBoxes;
+  leafBoxes.reserve(numBoxes);
+  std::copy_if(boxes.cbegin(), boxes.cend(), std::back_inserter(leafBoxes),
+               [](const API::IMDNode *box) { return box->isBox(); });
+  const auto numLeafBoxes = static_cast<int64_t>(leafBoxes.size());
+  // Progress report based on boxes merged.
+  m_progress = std::make_unique<Progress>(this, 0.1, 0.9, leafBoxes.size());
+  m_progress->setNotifyStep(0.1);
 
-  for (size_t ib = 0; ib < numBoxes; ib++) {
-    auto box = boxes[ib];
-    if (!box->isBox())
-      continue;
+  // Every box gathers its events from all input files and, if the target is file-backed, is written to its
+  // pre-calculated position and released straight away. Boxes are merged independently, so while one thread writes
+  // a merged box the others keep reading from the input files, and only as many boxes are held in memory at once as
+  // there are threads. Each input file and the output file is locked by its own IO object.
+  PRAGMA_OMP(parallel for schedule(dynamic, 1) if (parallel) )
+  for (int64_t ib = 0; ib < numLeafBoxes; ib++) {
+    PARALLEL_START_INTERRUPT_REGION
+    auto box = leafBoxes[ib];
     // load all contributed events into current box;
-    this->loadEventsFromSubBoxes(box);
+    const uint64_t nBoxEvents = this->loadEventsFromSubBoxes(box);
 
     if (DiskBuf) {
       if (box->getDataInMemorySize() > 0) { // data position has been already pre-calculated
         box->getISaveable()->save();
         box->clearDataFromMemory();
-        // Kernel::ISaveable *Saver = box->getISaveable();
-        // DiskBuf->toWrite(Saver);
       }
     }
-    // else
-    //{   size_t ID = box->getID();
-    //    uint64_t filePosition = targetEventIndexes[2*ID];
-    //    box->saveAt(saver.get(), filePosition);
-    //}
-    //
-    // if (!Parallel)
-    //{
-    //  // Run the task serially only
-    //  task->run();
-    //  delete task;
-    //}
-    // else
-    //{
-    //  // Enqueue to run in parallel (at the joinAll() call below).
-    //  ts->push(task);
-    //}
-
-    m_progress->reportIncrement(ib, "Loading and merging box data");
+    {
+      std::lock_guard<std::mutex> lock(m_statsMutex);
+      m_totalLoaded += nBoxEvents;
+    }
+
+    m_progress->report("Loading and merging box data");
+    PARALLEL_END_INTERRUPT_REGION
   }
+  PARALLEL_CHECK_INTERRUPT_REGION
   if (DiskBuf) {
     DiskBuf->flushCache();
     bc->getFileIO()->flushData();
   }
-  //// Run any final tasks
-  // tp.joinAll();
-  g_log.information() << overallTime << " to do all the adding.\n";
+  g_log.information() << overallTime << " to merge " << m_totalLoaded << " events.\n";
 
   // Close any open file handle
   clearEventLoaders();
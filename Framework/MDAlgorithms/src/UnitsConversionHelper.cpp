@@ -348,6 +348,35 @@ double UnitsConversionHelper::convertUnits(double val) const {
     throw std::runtime_error("updateConversion: unknown type of conversion requested");
   }
 }
+
+/** Convert all values of a spectrum in place. The type of the conversion is
+ * selected once for all values rather than for every one of them.
+ * @param values -- the values to convert, replaced by the converted values */
+void UnitsConversionHelper::convertUnits(std::vector<double> &values) const {
+  switch (m_UnitCnvrsn) {
+  case (CnvrtToMD::ConvertNo): {
+    return;
+  }
+  case (CnvrtToMD::ConvertFast): {
+    const double factor(m_Factor), power(m_Power);
+    for (auto &value : values)
+      value = factor * std::pow(value, power);
+    return;
+  }
+  case (CnvrtToMD::ConvertFromTOF): {
+    for (auto &value : values)
+      value = m_TargetUnit->singleFromTOF(value);
+    return;
+  }
+  case (CnvrtToMD::ConvertByTOF): {
+    for (auto &value : values)
+      value = m_TargetUnit->singleFromTOF(m_SourceWSUnit->singleToTOF(value));
+    return;
+  }
+  default:
+    throw std::runtime_error("updateConversion: unknown type of conversion requested");
+  }
+}
 // copy constructor;
 UnitsConversionHelper::UnitsConversionHelper(const UnitsConversionHelper &another) {
   m_UnitCnvrsn = another.m_UnitCnvrsn;
@@ -260,6 +260,85 @@ public:
                  true /*IterateEvents*/, 20 /*numEventsPerBox*/, VMD(0, 0, 1));
   }
 
+  void test_exec_3D_gridBoxesCompletelyContained() {
+    auto in_ws = makeDeepGridWorkspace();
+    AnalysisDataService::Instance().addOrReplace("BinMDTest_ws", in_ws);
+
+    // The first bin holds the whole gridded box from 0 to 5 in each dimension
+    auto out = binDeepGridWorkspace();
+    TS_ASSERT(out);
+
+    // 11 cells below 5.5 and 9 above in each dimension
+    const double cellsInBin[2] = {11., 9.};
+    for (size_t i = 0; i < 8; i++) {
+      const double expected = cellsInBin[i % 2] * cellsInBin[(i / 2) % 2] * cellsInBin[i / 4];
+      TS_ASSERT_DELTA(out->getSignalAt(i), expected, 1e-5);
+      TS_ASSERT_DELTA(out->getNumEventsAt(i), expected, 1e-5);
+    }
+    AnalysisDataService::Instance().remove("BinMDTest_ws");
+    AnalysisDataService::Instance().remove("BinMDTest_out");
+  }
+
+  void test_exec_3D_gridBoxesCompletelyContained_with_masked_boxes() {
+    auto in_ws = makeDeepGridWorkspace();
+    AnalysisDataService::Instance().addOrReplace("BinMDTest_ws", in_ws);
+    // mask some of the boxes within the gridded box from 0 to 5, so its cached signal cannot be used
+    FrameworkManager::Instance().exec("MaskMD", 6, "Workspace", "BinMDTest_ws", "Dimensions", "Axis0,Axis1,Axis2",
+                                      "Extents", "0,1,0,1,0,1");
+
+    // the events of the unmasked boxes below 5.5 in each dimension
+    std::vector<IMDNode *> leaves;
+    in_ws->getBox()->getBoxes(leaves, 1000, true);
+    double expected = 0.;
+    for (auto *leaf : leaves) {
+      auto *box = dynamic_cast<MDBox<MDLeanEvent<3>, 3> *>(leaf);
+      if (!box || box->getIsMasked())
+        continue;
+      for (const auto &event : box->getConstEvents()) {
+        if (event.getCenter(0) < 5.5 && event.getCenter(1) < 5.5 && event.getCenter(2) < 5.5)
+          expected += event.getSignal();
+      }
+      box->releaseEvents();
+    }
+    TS_ASSERT_LESS_THAN(expected, 11. * 11. * 11.);
+
+    auto out = binDeepGridWorkspace();
+    TS_ASSERT(out);
+    if (out)
+      TS_ASSERT_DELTA(out->getSignalAt(0), expected, 1e-5);
+    AnalysisDataService::Instance().remove("BinMDTest_ws");
+    AnalysisDataService::Instance().remove("BinMDTest_out");
+  }
+
+  /// One event in the middle of every cell of a 20x20x20 grid, split into a box tree several levels deep
+  MDEventWorkspace3Lean::sptr makeDeepGridWorkspace() {
+    auto in_ws = MDEventsTestHelper::makeMDEW<3>(2, 0.0, 10.0, 0);
+    in_ws->getBoxController()->setSplitThreshold(10);
+    in_ws->getBoxController()->setMaxDepth(5);
+    in_ws->splitBox();
+    for (size_t i = 0; i < 20 * 20 * 20; i++) {
+      const coord_t centers[3] = {0.25f + 0.5f * coord_t(i % 20), 0.25f + 0.5f * coord_t((i / 20) % 20),
+                                  0.25f + 0.5f * coord_t(i / 400)};
+      in_ws->addEvent(MDLeanEvent<3>(1.0, 1.0, centers));
+    }
+    in_ws->splitAllIfNeeded(nullptr);
+    in_ws->refreshCache();
+    return in_ws;
+  }
+
+  /// Bin BinMDTest_ws into two bins in each dimension, split at 5.5
+  MDHistoWorkspace_sptr binDeepGridWorkspace() {
+    BinMD alg;
+    alg.initialize();
+    alg.setPropertyValue("InputWorkspace", "BinMDTest_ws");
+    alg.setPropertyValue("AlignedDim0", "Axis0,-0.5,11.5,2");
+    alg.setPropertyValue("AlignedDim1", "Axis1,-0.5,11.5,2");
+    alg.setPropertyValue("AlignedDim2", "Axis2,-0.5,11.5,2");
+    alg.setPropertyValue("OutputWorkspace", "BinMDTest_out");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    return AnalysisDataService::Instance().retrieveWS<MDHistoWorkspace>("BinMDTest_out");
+  }
+
   bool etta(int x, int base) {
     int ii = x - base / 2;
     if (ii < 0)
@@ -193,6 +193,14 @@ public:
                       Mantid::API::NumEventsNormalization);
   }
 
+  void testBatchedDirectInelasticModeMatchesSingleValues() {
+    doTestBatchedMatchesSingleValues(Kernel::DeltaEMode::Direct);
+  }
+
+  void testBatchedIndirectInelasticModeMatchesSingleValues() {
+    doTestBatchedMatchesSingleValues(Kernel::DeltaEMode::Indirect);
+  }
+
   MDTransfModQTest() {
 
     ws2D = WorkspaceCreationHelper::createProcessedWorkspaceWithCylComplexInstrument(4, 10, true);
@@ -202,4 +210,50 @@ public:
     ws2D->mutableRun().addProperty("Ei", 13., "meV", true);
     ws2D->mutableRun().addProperty("T", 70., "K", true);
   }
+
+private:
+  void doTestBatchedMatchesSingleValues(const Kernel::DeltaEMode::Type emode) {
+    auto ws = WorkspaceCreationHelper::createProcessedWorkspaceWithCylComplexInstrument(4, 10, true);
+    ws->mutableRun().mutableGoniometer().setRotationAngle(0, 20);
+    // the preprocessed detectors take efixed from Ei in the log in indirect mode too
+    ws->mutableRun().addProperty("Ei", 2.45, "meV", true);
+    MDTransfModQ modQTransform;
+    MDWSDescription wsDescription(2);
+    wsDescription.setMinMax({0, -100}, {100, 100});
+    wsDescription.buildFromMatrixWS(ws, modQTransform.transfID(), Kernel::DeltaEMode::asString(emode), {});
+    auto ppDets_alg = Mantid::API::AlgorithmManager::Instance().createUnmanaged("PreprocessDetectorsToMD");
+    ppDets_alg->initialize();
+    ppDets_alg->setChild(true);
+    ppDets_alg->setProperty("InputWorkspace", ws);
+    ppDets_alg->setProperty("OutputWorkspace", "UnitsConversionHelperTableWs");
+    ppDets_alg->execute();
+    wsDescription.m_PreprDetTable = ppDets_alg->getProperty("OutputWorkspace");
+    modQTransform.initialize(wsDescription);
+
+    std::vector<coord_t> qOmega{0.0, 0.0};
+    modQTransform.calcYDepCoordinates(qOmega, 1);
+
+    // the last energy transfer is outside of the limits
+    const std::vector<double> deltaE{-1.5, -0.3, 0., 0.8, 2., 150.};
+    std::vector<double> signal(deltaE.size(), 1.), error(deltaE.size(), 2.);
+    std::vector<coord_t> allCoord;
+    std::vector<char> accepted;
+    const size_t nAccepted = modQTransform.calcMatrixCoords(deltaE, qOmega, signal, error, allCoord, accepted);
+
+    TS_ASSERT_EQUALS(deltaE.size() - 1, nAccepted);
+    TS_ASSERT_EQUALS(2 * nAccepted, allCoord.size());
+    auto coord = allCoord.cbegin();
+    for (size_t i = 0; i < deltaE.size(); ++i) {
+      double s{1.}, err{2.};
+      const bool inRange = modQTransform.calcMatrixCoord(deltaE[i], qOmega, s, err);
+      TS_ASSERT_EQUALS(inRange, accepted[i] != 0);
+      if (!inRange)
+        continue;
+      TS_ASSERT_DELTA(qOmega[0], coord[0], 1e-5);
+      TS_ASSERT_DELTA(qOmega[1], coord[1], 1e-5);
+      TS_ASSERT_EQUALS(s, signal[i]);
+      TS_ASSERT_EQUALS(err, error[i]);
+      coord += 2;
+    }
+  }
 };
@@ -233,4 +233,41 @@ public:
     TS_ASSERT_DELTA(1.0, signal, 1e-05)
     TS_ASSERT_DELTA(1.0, error, 1e-05)
   }
+
+  void testBatchedDirectInelasticModeMatchesSingleValues() { doTestBatchedMatchesSingleValues(DeltaEMode::Direct); }
+
+  void testBatchedIndirectInelasticModeMatchesSingleValues() {
+    doTestBatchedMatchesSingleValues(DeltaEMode::Indirect);
+  }
+
+private:
+  void doTestBatchedMatchesSingleValues(const DeltaEMode::Type emode) {
+    MDTransfQ3DTestHelper q3dTransform;
+    MDWSDescription wsDescription;
+    std::tie(q3dTransform, wsDescription) = createTestTransform(2.45, emode);
+    std::vector<coord_t> qOmega{0.0, 0.0, 0.0, 0.0};
+    q3dTransform.calcYDepCoordinates(qOmega, 1);
+
+    // the last energy transfer is outside of the limits
+    const std::vector<double> deltaE{-1.5, -0.3, 0., 0.8, 2., 150.};
+    std::vector<double> signal(deltaE.size(), 1.), error(deltaE.size(), 2.);
+    std::vector<coord_t> allCoord;
+    std::vector<char> accepted;
+    const size_t nAccepted = q3dTransform.calcMatrixCoords(deltaE, qOmega, signal, error, allCoord, accepted);
+
+    TS_ASSERT_EQUALS(deltaE.size() - 1, nAccepted)
+    TS_ASSERT_EQUALS(4 * nAccepted, allCoord.size())
+    auto coord = allCoord.cbegin();
+    for (size_t i = 0; i < deltaE.size(); ++i) {
+      double s{1.}, err{2.};
+      const bool inRange = q3dTransform.calcMatrixCoord(deltaE[i], qOmega, s, err);
+      TS_ASSERT_EQUALS(inRange, accepted[i] != 0)
+      if (!inRange)
+        continue;
+      TS_ASSERT_EQUALS(qOmega, std::vector<coord_t>(coord, coord + 4))
+      TS_ASSERT_EQUALS(s, signal[i])
+      TS_ASSERT_EQUALS(err, error[i])
+      coord += 4;
+    }
+  }
 };
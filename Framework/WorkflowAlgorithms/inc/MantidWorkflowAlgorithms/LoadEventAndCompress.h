@@ -22,6 +22,7 @@ public:
   const std::vector<std::string> seeAlso() const override { return {"LoadEventNexus", "CompressEvents"}; }
   const std::string category() const override;
   const std::string summary() const override;
+  std::map<std::string, std::string> validateInputs() override;
 
 protected:
   API::ITableWorkspace_sptr determineChunk(const std::string &filename) override;
@@ -30,6 +31,7 @@ protected:
 private:
   void init() override;
   void exec() override;
+  API::MatrixWorkspace_sptr processChunk(const API::MatrixWorkspace_sptr &chunkWS);
 
   API::ITableWorkspace_sptr m_chunkingTable;
   double m_filterBadPulses;
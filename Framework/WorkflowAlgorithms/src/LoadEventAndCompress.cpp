@@ -5,6 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidWorkflowAlgorithms/LoadEventAndCompress.h"
+#include "MantidAPI/AlgorithmFactory.h"
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/FileProperty.h"
 #include "MantidAPI/FrameworkManager.h"
@@ -12,6 +13,7 @@
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/Strings.h"
 #include "MantidKernel/VisibleWhenProperty.h"
 
 namespace Mantid::WorkflowAlgorithms {
@@ -98,6 +100,35 @@ void LoadEventAndCompress::init() {
   auto range = std::make_shared<BoundedValidator<double>>();
   range->setBounds(0., 100.);
   declareProperty("FilterBadPulses", 95., range);
+
+  declareProperty(std::make_unique<PropertyWithValue<std::string>>("ProcessingAlgorithm", "", Direction::Input),
+                  "Name of the algorithm that will be run to process each chunk of data before it is accumulated, "
+                  "e.g. AlignAndFocusPowder.\n"
+                  "Optional. If blank, no processing will occur. Only the processed chunks are kept, so memory "
+                  "use is bounded by MaxChunkSize and the size of the processed output rather than the whole run. "
+                  "The sample logs are loaded for every chunk so they can be used by the processing.");
+  declareProperty(std::make_unique<PropertyWithValue<std::string>>("ProcessingProperties", "", Direction::Input),
+                  "The properties to pass to the ProcessingAlgorithm, as a single string.\n"
+                  "The format is propName=value;propName=value");
+
+  std::string grp5 = "Chunk Processing";
+  setPropertyGroup("ProcessingAlgorithm", grp5);
+  setPropertyGroup("ProcessingProperties", grp5);
+}
+
+/// @see Algorithm::validateInputs
+std::map<std::string, std::string> LoadEventAndCompress::validateInputs() {
+  std::map<std::string, std::string> result;
+
+  const std::string algoName = Strings::strip(getPropertyValue("ProcessingAlgorithm"));
+  if (algoName.empty()) {
+    if (!getPropertyValue("ProcessingProperties").empty())
+      result["ProcessingProperties"] = "Cannot be set without a ProcessingAlgorithm";
+  } else if (!AlgorithmFactory::Instance().exists(algoName)) {
+    result["ProcessingAlgorithm"] = "Algorithm '" + algoName + "' is not registered";
+  }
+
+  return result;
 }
 
 /// @see DataProcessorAlgorithm::determineChunk(const std::string &)
@@ -153,8 +184,10 @@ MatrixWorkspace_sptr LoadEventAndCompress::loadChunk(const size_t rowIndex) {
 
   // determine if loading logs - always load logs for first chunk or
   // `FilterBadPulses` which will change delete some of the proton_charge log
-  // and change its value
-  bool loadLogs = (rowIndex == 0) || (m_filterBadPulses > 0.);
+  // and change its value. The `ProcessingAlgorithm` is run on every chunk and
+  // may need the sample logs, e.g. to filter by a log or normalise by the proton charge
+  bool loadLogs = (rowIndex == 0) || (m_filterBadPulses > 0.) ||
+                  !Strings::strip(getPropertyValue("ProcessingAlgorithm")).empty();
   if (!loadLogs) {
     // logs are needed for any of these
     const double filterByTimeStart = getProperty("FilterByTimeStart");
@@ -179,6 +212,25 @@ MatrixWorkspace_sptr LoadEventAndCompress::loadChunk(const size_t rowIndex) {
   return std::dynamic_pointer_cast<MatrixWorkspace>(wksp);
 }
 
+/** Run the ProcessingAlgorithm on a chunk that has just been loaded. The unprocessed chunk is released as soon as
+ * the processing has finished.
+ * @param chunkWS :: the chunk to process
+ * @return the processed chunk, or the chunk itself if there is no ProcessingAlgorithm
+ */
+MatrixWorkspace_sptr LoadEventAndCompress::processChunk(const MatrixWorkspace_sptr &chunkWS) {
+  const std::string algoName = Strings::strip(getPropertyValue("ProcessingAlgorithm"));
+  if (algoName.empty())
+    return chunkWS;
+
+  g_log.debug() << "Processing chunk using " << algoName << "\n";
+  auto alg = createChildAlgorithm(algoName);
+  // Skip the workspaces when setting
+  alg->setPropertiesWithString(getPropertyValue("ProcessingProperties"), {"InputWorkspace", "OutputWorkspace"});
+  alg->setProperty("InputWorkspace", chunkWS);
+  alg->executeAsChildAlg();
+  return alg->getProperty("OutputWorkspace");
+}
+
 //----------------------------------------------------------------------------------------------
 /** Execute the algorithm.
  */
@@ -192,7 +244,7 @@ void LoadEventAndCompress::exec() {
 
   // first run is free
   progress.report("Loading Chunk");
-  MatrixWorkspace_sptr resultWS = loadChunk(0);
+  MatrixWorkspace_sptr resultWS = processChunk(loadChunk(0));
 
   // load the other chunks
   const size_t numRows = m_chunkingTable->rowCount();
@@ -200,7 +252,7 @@ void LoadEventAndCompress::exec() {
   progress.resetNumSteps(numRows, 0, 1);
 
   for (size_t i = 1; i < numRows; ++i) {
-    MatrixWorkspace_sptr temp = loadChunk(i);
+    MatrixWorkspace_sptr temp = processChunk(loadChunk(i));
 
     // remove logs
     auto removeLogsAlg = createChildAlgorithm("RemoveLogs");
@@ -221,8 +273,9 @@ void LoadEventAndCompress::exec() {
   }
 
   // don't assume that any chunk had the correct binning so just reset it here
+  // unless the processing has set its own binning
   EventWorkspace_sptr totalEventWS = std::dynamic_pointer_cast<EventWorkspace>(resultWS);
-  if (totalEventWS->getNEvents())
+  if (totalEventWS && totalEventWS->getNEvents() && Strings::strip(getPropertyValue("ProcessingAlgorithm")).empty())
     totalEventWS->resetAllXToSingleBin();
 
   // Don't bother compressing combined workspace. DetermineChunking is designed
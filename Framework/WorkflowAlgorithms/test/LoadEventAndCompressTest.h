@@ -118,6 +118,134 @@ public:
     AnalysisDataService::Instance().remove(WS_NAME);
   }
 
+  void test_validate_ProcessingAlgorithm() {
+    LoadEventAndCompress alg;
+    alg.initialize();
+    alg.setPropertyValue("Filename", FILENAME);
+    alg.setPropertyValue("OutputWorkspace", "LoadEventAndCompress_unused");
+    alg.setPropertyValue("ProcessingProperties", "Params=1000");
+    auto errors = alg.validateInputs();
+    TS_ASSERT_EQUALS(errors.size(), 1);
+    TS_ASSERT_EQUALS(errors.count("ProcessingProperties"), 1);
+
+    alg.setPropertyValue("ProcessingAlgorithm", "NotAnAlgorithm");
+    errors = alg.validateInputs();
+    TS_ASSERT_EQUALS(errors.size(), 1);
+    TS_ASSERT_EQUALS(errors.count("ProcessingAlgorithm"), 1);
+  }
+
+  void test_exec_with_ProcessingAlgorithm() {
+    const std::string PARAMS("1000,100,16000");
+
+    // histogram the whole run after loading it
+    const std::string WS_NAME_EXPECTED("LoadEventAndCompress_processing_expected");
+    LoadEventAndCompress algWithoutChunks;
+    algWithoutChunks.initialize();
+    algWithoutChunks.setPropertyValue("Filename", FILENAME);
+    algWithoutChunks.setPropertyValue("OutputWorkspace", WS_NAME_EXPECTED);
+    TS_ASSERT_THROWS_NOTHING(algWithoutChunks.execute());
+    auto rebin = AlgorithmManager::Instance().create("Rebin");
+    rebin->setPropertyValue("InputWorkspace", WS_NAME_EXPECTED);
+    rebin->setPropertyValue("OutputWorkspace", WS_NAME_EXPECTED);
+    rebin->setPropertyValue("Params", PARAMS);
+    rebin->setProperty("PreserveEvents", false);
+    rebin->execute();
+    TS_ASSERT(rebin->isExecuted());
+
+    // histogram each chunk as it is loaded
+    const std::string WS_NAME_CHUNKS("LoadEventAndCompress_processing_chunks");
+    LoadEventAndCompress algWithChunks;
+    algWithChunks.initialize();
+    algWithChunks.setPropertyValue("Filename", FILENAME);
+    algWithChunks.setPropertyValue("OutputWorkspace", WS_NAME_CHUNKS);
+    algWithChunks.setProperty("MaxChunkSize", CHUNKSIZE);
+    algWithChunks.setPropertyValue("ProcessingAlgorithm", "Rebin");
+    algWithChunks.setPropertyValue("ProcessingProperties", "Params=" + PARAMS + ";PreserveEvents=0");
+    TS_ASSERT_THROWS_NOTHING(algWithChunks.execute());
+    TS_ASSERT(algWithChunks.isExecuted());
+
+    MatrixWorkspace_sptr wsWithChunks;
+    TS_ASSERT_THROWS_NOTHING(wsWithChunks =
+                                 AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(WS_NAME_CHUNKS));
+    TS_ASSERT(wsWithChunks);
+    if (!wsWithChunks)
+      return;
+    TS_ASSERT(!std::dynamic_pointer_cast<EventWorkspace>(wsWithChunks));
+
+    auto checkAlg = AlgorithmManager::Instance().create("CompareWorkspaces");
+    checkAlg->setPropertyValue("Workspace1", WS_NAME_EXPECTED);
+    checkAlg->setPropertyValue("Workspace2", WS_NAME_CHUNKS);
+    checkAlg->setProperty("Tolerance", 1.e-8);
+    checkAlg->setProperty("CheckAllData", true);
+    checkAlg->execute();
+    TS_ASSERT(checkAlg->getProperty("Result"));
+
+    AnalysisDataService::Instance().remove(WS_NAME_EXPECTED);
+    AnalysisDataService::Instance().remove(WS_NAME_CHUNKS);
+  }
+
+  void test_exec_with_ProcessingAlgorithm_that_needs_logs() {
+    const std::string filename{"CNCS_7860_event.nxs"};
+    const std::string PARAMS("50000,1000,54000");
+
+    // normalise the whole run by the proton charge after loading it
+    const std::string WS_NAME_EXPECTED("LoadEventAndCompress_normalised_expected");
+    auto ld = AlgorithmManager::Instance().create("LoadEventNexus", 1);
+    ld->setPropertyValue("Filename", filename);
+    ld->setPropertyValue("OutputWorkspace", WS_NAME_EXPECTED);
+    ld->setProperty("NumberOfBins", 1);
+    ld->execute();
+    TS_ASSERT(ld->isExecuted());
+
+    auto compress = AlgorithmManager::Instance().create("CompressEvents", 1);
+    compress->setPropertyValue("InputWorkspace", WS_NAME_EXPECTED);
+    compress->setPropertyValue("OutputWorkspace", WS_NAME_EXPECTED);
+    compress->setProperty("Tolerance", 0.01);
+    compress->execute();
+    TS_ASSERT(compress->isExecuted());
+
+    auto normalise = AlgorithmManager::Instance().create("NormaliseByCurrent", 1);
+    normalise->setPropertyValue("InputWorkspace", WS_NAME_EXPECTED);
+    normalise->setPropertyValue("OutputWorkspace", WS_NAME_EXPECTED);
+    normalise->execute();
+    TS_ASSERT(normalise->isExecuted());
+
+    // normalise each chunk as it is loaded, without FilterBadPulses which would load the logs anyway
+    const std::string WS_NAME_CHUNKS("LoadEventAndCompress_normalised_chunks");
+    LoadEventAndCompress alg;
+    alg.initialize();
+    alg.setPropertyValue("Filename", filename);
+    alg.setPropertyValue("OutputWorkspace", WS_NAME_CHUNKS);
+    alg.setProperty("MaxChunkSize", 0.001); // results in loading by 6 chunks
+    alg.setProperty("FilterBadPulses", 0.);
+    alg.setPropertyValue("ProcessingAlgorithm", "NormaliseByCurrent");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    // must rebin the same so it can be compared with CompareWorkspaces
+    for (const auto &wsName : {WS_NAME_EXPECTED, WS_NAME_CHUNKS}) {
+      auto rebin = AlgorithmManager::Instance().create("Rebin", 1);
+      rebin->setPropertyValue("InputWorkspace", wsName);
+      rebin->setPropertyValue("OutputWorkspace", wsName);
+      rebin->setPropertyValue("Params", PARAMS);
+      rebin->setProperty("PreserveEvents", false);
+      rebin->execute();
+      TS_ASSERT(rebin->isExecuted());
+    }
+
+    auto checkAlg = AlgorithmManager::Instance().create("CompareWorkspaces");
+    checkAlg->setPropertyValue("Workspace1", WS_NAME_EXPECTED);
+    checkAlg->setPropertyValue("Workspace2", WS_NAME_CHUNKS);
+    checkAlg->setProperty("Tolerance", 1.e-8);
+    checkAlg->setProperty("ToleranceRelErr", true);
+    checkAlg->setProperty("CheckAllData", true);
+    checkAlg->execute();
+    TS_ASSERT(checkAlg->getProperty("Result"));
+
+    AnalysisDataService::Instance().remove(WS_NAME_EXPECTED);
+    AnalysisDataService::Instance().remove(WS_NAME_CHUNKS);
+  }
+
   void test_CNCS() {
     const std::string filename{"CNCS_7860_event.nxs"};
 